@@ -0,0 +1,90 @@
+#ifndef _CANDIDATECLEANER_H_
+#define _CANDIDATECLEANER_H_
+
+#include "pxl/hep.hh"
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+/*
+* Collects the candidates rejected by a selection and drops them after all
+* candidates of a view were evaluated. The default 'remove' mode deletes
+* them with EventView::removeObject. pxl offers no bulk removal and every
+* call searches the object container, so this still costs
+* O(objects x rejected) per view; collecting only keeps the removal out of
+* the candidate loop. The 'mark' mode renames them instead at one
+* assignment per candidate: all modules of this tree select particles by
+* their configured names and skip them, but they stay in the written
+* events.
+*/
+class CandidateCleaner
+{
+    public:
+    enum Mode
+    {
+        KEEP,
+        REMOVE,
+        MARK
+    };
+
+    private:
+    Mode _mode;
+    std::string _droppedName;
+    std::vector<pxl::Particle*> _rejected;
+
+    public:
+    CandidateCleaner():
+        _mode(REMOVE),
+        _droppedName("Dropped")
+    {
+    }
+
+    static Mode parseMode(const std::string& mode) throw (std::runtime_error)
+    {
+        if (mode=="remove")
+        {
+            return REMOVE;
+        } else if (mode=="mark") {
+            return MARK;
+        } else if (mode=="keep") {
+            return KEEP;
+        }
+        throw std::runtime_error("unknown clean mode '"+mode+"', use 'remove', 'mark' or 'keep'");
+    }
+
+    void setMode(Mode mode, const std::string& droppedName)
+    {
+        _mode = mode;
+        _droppedName = droppedName;
+        _rejected.clear();
+    }
+
+    inline void reject(pxl::Particle* particle)
+    {
+        if (_mode!=KEEP)
+        {
+            _rejected.push_back(particle);
+        }
+    }
+
+    void clean(pxl::EventView* eventView)
+    {
+        if (_mode==MARK)
+        {
+            for (unsigned iparticle=0; iparticle<_rejected.size(); ++iparticle)
+            {
+                _rejected[iparticle]->setName(_droppedName);
+            }
+        } else if (_mode==REMOVE) {
+            //each removal is a linear search in the container, pxl has no bulk removal
+            for (unsigned iparticle=_rejected.size(); iparticle>0; --iparticle)
+            {
+                eventView->removeObject(_rejected[iparticle-1]);
+            }
+        }
+        _rejected.clear();
+    }
+};
+
+#endif
@@ -0,0 +1,672 @@
+#include "CutEngine.hpp"
+
+#include <cstdlib>
+#include <cctype>
+#include <algorithm>
+
+static std::string trim(const std::string& s)
+{
+    size_t begin = s.find_first_not_of(" \t\r\n");
+    if (begin==std::string::npos)
+    {
+        return "";
+    }
+    size_t end = s.find_last_not_of(" \t\r\n");
+    return s.substr(begin,end-begin+1);
+}
+
+static bool isNameCharacter(const std::string& s, size_t pos)
+{
+    char c = s[pos];
+    if (isalnum(c) || c=='_' || c=='.')
+    {
+        return true;
+    }
+    //record names like 'isInEB-EE' contain dashes; '->' is the condition operator
+    return c=='-' && pos+1<s.size() && s[pos+1]!='>' && pos>0 && isalnum(s[pos-1]);
+}
+
+static CutOperand parseOperand(const std::string& expression, const std::string& cut)
+{
+    CutOperand operand;
+    std::string name = trim(expression);
+    if (name.size()>5 && name.compare(0,4,"abs(")==0 && name[name.size()-1]==')')
+    {
+        operand.absolute=true;
+        name = trim(name.substr(4,name.size()-5));
+    }
+    if (name.empty())
+    {
+        throw std::runtime_error("missing quantity in cut '"+cut+"'");
+    }
+    for (unsigned ichar=0; ichar<name.size(); ++ichar)
+    {
+        if (!isNameCharacter(name,ichar))
+        {
+            throw std::runtime_error("invalid quantity '"+name+"' in cut '"+cut+"'");
+        }
+    }
+    if (name=="pt")
+    {
+        operand.source=CutOperand::PT;
+    }
+    else if (name=="eta")
+    {
+        operand.source=CutOperand::ETA;
+    }
+    else if (name=="phi")
+    {
+        operand.source=CutOperand::PHI;
+    }
+    else if (name=="energy")
+    {
+        operand.source=CutOperand::ENERGY;
+    }
+    else if (name=="mass")
+    {
+        operand.source=CutOperand::MASS;
+    }
+    else
+    {
+        operand.source=CutOperand::RECORD;
+        operand.key=name;
+    }
+    return operand;
+}
+
+static bool readsRecords(const CutTest& cutTest)
+{
+    return cutTest.comparison==CutTest::PREDICATE
+        || cutTest.numerator.source==CutOperand::RECORD
+        || cutTest.denominator.source==CutOperand::RECORD;
+}
+
+void CutEngine::addPredicate(const std::string& name, Predicate predicate)
+{
+    _predicateNames.push_back(name);
+    _predicates.push_back(predicate);
+}
+
+CutTest CutEngine::parseTest(const std::string& expression) const
+{
+    CutTest cutTest;
+    std::string cut = trim(expression);
+
+    //registered predicate
+    if (cut.size()>2 && cut.compare(cut.size()-2,2,"()")==0 && cut.compare(0,4,"abs(")!=0)
+    {
+        std::string name = trim(cut.substr(0,cut.size()-2));
+        for (unsigned ipredicate=0; ipredicate<_predicateNames.size(); ++ipredicate)
+        {
+            if (_predicateNames[ipredicate]==name)
+            {
+                cutTest.comparison=CutTest::PREDICATE;
+                cutTest.predicate=ipredicate;
+                return cutTest;
+            }
+        }
+        throw std::runtime_error("unknown predicate '"+name+"' in cut '"+cut+"'");
+    }
+
+    size_t pos = cut.find_first_of("<>=!");
+    //boolean user record
+    if (pos==std::string::npos || (pos==0 && cut[0]=='!' && cut.find_first_of("<>=",1)==std::string::npos))
+    {
+        bool negate = pos==0;
+        cutTest.numerator = parseOperand(negate ? cut.substr(1) : cut,cut);
+        if (cutTest.numerator.source!=CutOperand::RECORD || cutTest.numerator.absolute)
+        {
+            throw std::runtime_error("boolean cut '"+cut+"' needs to be a user record");
+        }
+        cutTest.comparison = negate ? CutTest::IS_FALSE : CutTest::IS_TRUE;
+        return cutTest;
+    }
+
+    std::string op;
+    if (pos+1<cut.size() && cut[pos+1]=='=')
+    {
+        op = cut.substr(pos,2);
+    }
+    else
+    {
+        op = cut.substr(pos,1);
+    }
+    if (op=="<")
+    {
+        cutTest.comparison=CutTest::LESS;
+    }
+    else if (op=="<=")
+    {
+        cutTest.comparison=CutTest::LESS_EQUAL;
+    }
+    else if (op==">")
+    {
+        cutTest.comparison=CutTest::GREATER;
+    }
+    else if (op==">=")
+    {
+        cutTest.comparison=CutTest::GREATER_EQUAL;
+    }
+    else if (op=="==")
+    {
+        cutTest.comparison=CutTest::EQUAL;
+    }
+    else if (op=="!=")
+    {
+        cutTest.comparison=CutTest::NOT_EQUAL;
+    }
+    else
+    {
+        throw std::runtime_error("unknown comparison '"+op+"' in cut '"+cut+"'");
+    }
+
+    std::string lhs = cut.substr(0,pos);
+    size_t divide = lhs.find('/');
+    if (divide!=std::string::npos)
+    {
+        cutTest.numerator = parseOperand(lhs.substr(0,divide),cut);
+        cutTest.denominator = parseOperand(lhs.substr(divide+1),cut);
+    }
+    else
+    {
+        cutTest.numerator = parseOperand(lhs,cut);
+    }
+
+    std::string rhs = trim(cut.substr(pos+op.size()));
+    char* end = 0;
+    cutTest.threshold = strtod(rhs.c_str(),&end);
+    if (rhs.empty() || *end!='\0')
+    {
+        throw std::runtime_error("invalid threshold '"+rhs+"' in cut '"+cut+"'");
+    }
+    return cutTest;
+}
+
+void CutEngine::compile(const std::string& cuts) throw (std::runtime_error)
+{
+    _ops.clear();
+    _order.clear();
+    _instrumented = false;
+    _reportCutFlow = false;
+    _adaptive = false;
+    _columns.clear();
+    size_t begin = 0;
+    while (begin<=cuts.size())
+    {
+        size_t end = cuts.find(';',begin);
+        if (end==std::string::npos)
+        {
+            end = cuts.size();
+        }
+        std::string expression = trim(cuts.substr(begin,end-begin));
+        begin = end+1;
+        if (expression.empty())
+        {
+            continue;
+        }
+        CutOp op;
+        op.expression = expression;
+        size_t arrow = expression.find("->");
+        if (arrow!=std::string::npos)
+        {
+            op.conditional = true;
+            op.condition = parseTest(expression.substr(0,arrow));
+            op.test = parseTest(expression.substr(arrow+2));
+        }
+        else
+        {
+            op.conditional = false;
+            op.test = parseTest(expression);
+        }
+        op.scaled = op.test.isScaled() || (op.conditional && op.condition.isScaled());
+        op.record = readsRecords(op.test) || (op.conditional && readsRecords(op.condition));
+        if (op.conditional)
+        {
+            assignColumns(op.condition);
+        }
+        assignColumns(op.test);
+        _order.push_back(_ops.size());
+        _ops.push_back(op);
+    }
+}
+
+bool CutEngine::isScaled() const
+{
+    for (unsigned iop=0; iop<_ops.size(); ++iop)
+    {
+        if (_ops[iop].scaled)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CutEngine::passScaled(pxl::Particle* particle, const std::vector<double>& scales, std::vector<char>& result, bool passedUnscaled) const
+{
+    result.assign(scales.size(),0);
+    for (unsigned iorder=0; !passedUnscaled && iorder<_order.size(); ++iorder)
+    {
+        const CutOp& op = _ops[_order[iorder]];
+        if (!op.scaled && not test(op,particle))
+        {
+            return;
+        }
+    }
+    for (unsigned iscale=0; iscale<scales.size(); ++iscale)
+    {
+        bool passed = true;
+        for (unsigned iorder=0; passed && iorder<_order.size(); ++iorder)
+        {
+            const CutOp& op = _ops[_order[iorder]];
+            if (op.scaled)
+            {
+                passed = test(op,particle,scales[iscale]);
+            }
+        }
+        result[iscale] = passed;
+    }
+}
+
+void CutEngine::enableCutFlow(const std::string& name)
+{
+    std::vector<std::string> expressions;
+    for (unsigned iop=0; iop<_ops.size(); ++iop)
+    {
+        expressions.push_back(_ops[iop].expression);
+    }
+    _cutFlow.reset(name,expressions);
+    _instrumented = true;
+    _reportCutFlow = true;
+}
+
+void CutEngine::enableAdaptiveOrder(uint64_t warmupCandidates) throw (std::runtime_error)
+{
+    if (warmupCandidates==0)
+    {
+        throw std::runtime_error("adaptive cut order needs a warm-up of at least 1 candidate");
+    }
+    if (!_instrumented)
+    {
+        enableCutFlow("");
+        _reportCutFlow = false;
+    }
+    _adaptive = true;
+    _warmupCandidates = warmupCandidates;
+}
+
+struct AdaptiveKey
+{
+    unsigned op;
+    double key;
+
+    bool operator<(const AdaptiveKey& rhs) const
+    {
+        return key>rhs.key;
+    }
+};
+
+void CutEngine::adaptOrder()
+{
+    const std::vector<CutFlow::Entry>& entries = _cutFlow.getEntries();
+    //measured cuts are sorted into the positions held by measured cuts, the others stay in place
+    std::vector<AdaptiveKey> keys;
+    std::vector<unsigned> positions;
+    for (unsigned iorder=0; iorder<_order.size(); ++iorder)
+    {
+        const CutFlow::Entry& entry = entries[_order[iorder]];
+        if (entry.tested>0 && entry.sampled>0)
+        {
+            AdaptiveKey key;
+            key.op = _order[iorder];
+            double rejection = 1.0-1.0*entry.passed/entry.tested;
+            double cost = std::max(1.0*entry.cycles/entry.sampled,1.0);
+            key.key = rejection/cost;
+            keys.push_back(key);
+            positions.push_back(iorder);
+        }
+    }
+    std::stable_sort(keys.begin(),keys.end());
+    std::vector<unsigned> proposed(_order);
+    for (unsigned ikey=0; ikey<keys.size(); ++ikey)
+    {
+        proposed[positions[ikey]] = keys[ikey].op;
+    }
+
+    //take the first proposed cut which is allowed next: a record cut only once all cuts written before it are placed
+    std::vector<char> placed(_ops.size(),0);
+    unsigned firstUnplaced = 0;
+    for (unsigned iorder=0; iorder<_order.size(); ++iorder)
+    {
+        for (unsigned iproposed=0; iproposed<proposed.size(); ++iproposed)
+        {
+            unsigned iop = proposed[iproposed];
+            if (placed[iop] || (_ops[iop].record && iop>firstUnplaced))
+            {
+                continue;
+            }
+            _order[iorder] = iop;
+            placed[iop] = 1;
+            break;
+        }
+        while (firstUnplaced<_ops.size() && placed[firstUnplaced])
+        {
+            ++firstUnplaced;
+        }
+    }
+    _adaptive = false;
+    _instrumented = _reportCutFlow;
+}
+
+bool CutEngine::passInstrumented(pxl::Particle* particle)
+{
+    if (_adaptive && _cutFlow.getCandidates()>=_warmupCandidates)
+    {
+        adaptOrder();
+        if (!_instrumented)
+        {
+            return pass(particle);
+        }
+    }
+    bool timed = _cutFlow.beginCandidate();
+    for (unsigned iorder=0; iorder<_order.size(); ++iorder)
+    {
+        unsigned iop = _order[iorder];
+        bool passed;
+        if (timed)
+        {
+            uint64_t start = readCycleCounter();
+            passed = test(_ops[iop],particle);
+            _cutFlow.addCycles(iop,readCycleCounter()-start);
+        }
+        else
+        {
+            passed = test(_ops[iop],particle);
+        }
+        _cutFlow.count(iop,passed);
+        if (not passed)
+        {
+            return false;
+        }
+    }
+    _cutFlow.acceptCandidate();
+    return true;
+}
+
+void CutEngine::pass(const std::vector<pxl::Particle*>& candidates, std::vector<char>& result)
+{
+    if (_batch)
+    {
+        passBatch(candidates,result);
+        return;
+    }
+    result.resize(candidates.size());
+    for (unsigned icandidate=0; icandidate<candidates.size(); ++icandidate)
+    {
+        result[icandidate] = pass(candidates[icandidate]);
+    }
+}
+
+int CutEngine::addColumn(const CutOperand& operand, bool boolean)
+{
+    if (operand.source==CutOperand::NONE)
+    {
+        return -1;
+    }
+    for (unsigned icolumn=0; icolumn<_columns.size(); ++icolumn)
+    {
+        const Column& column = _columns[icolumn];
+        if (column.source==operand.source && column.key==operand.key && column.boolean==boolean)
+        {
+            return icolumn;
+        }
+    }
+    Column column;
+    column.source = operand.source;
+    column.key = operand.key;
+    column.boolean = boolean;
+    _columns.push_back(column);
+    return _columns.size()-1;
+}
+
+void CutEngine::assignColumns(CutTest& cutTest)
+{
+    if (cutTest.comparison==CutTest::PREDICATE)
+    {
+        return;
+    }
+    bool boolean = cutTest.comparison==CutTest::IS_TRUE || cutTest.comparison==CutTest::IS_FALSE;
+    cutTest.numerator.column = addColumn(cutTest.numerator,boolean);
+    cutTest.denominator.column = addColumn(cutTest.denominator,false);
+}
+
+void CutEngine::loadColumns(const std::vector<pxl::Particle*>& candidates)
+{
+    unsigned size = candidates.size();
+    for (unsigned icolumn=0; icolumn<_columns.size(); ++icolumn)
+    {
+        Column& column = _columns[icolumn];
+        column.values.resize(size);
+        if (column.source==CutOperand::RECORD)
+        {
+            column.loaded.assign(size,0);
+            continue;
+        }
+        double* values = column.values.data();
+        for (unsigned i=0; i<size; ++i)
+        {
+            pxl::Particle* particle = candidates[i];
+            switch (column.source)
+            {
+                case CutOperand::PT:
+                    values[i] = particle->getPt();
+                    break;
+                case CutOperand::ETA:
+                    values[i] = particle->getEta();
+                    break;
+                case CutOperand::PHI:
+                    values[i] = particle->getPhi();
+                    break;
+                case CutOperand::ENERGY:
+                    values[i] = particle->getE();
+                    break;
+                case CutOperand::MASS:
+                    values[i] = particle->getMass();
+                    break;
+                default:
+                    values[i] = 0;
+            }
+        }
+    }
+}
+
+const double* CutEngine::getColumn(const CutOperand& operand, const std::vector<pxl::Particle*>& candidates, const std::vector<unsigned char>& active)
+{
+    Column& column = _columns[operand.column];
+    if (column.source==CutOperand::RECORD)
+    {
+        for (unsigned i=0; i<candidates.size(); ++i)
+        {
+            if (active[i] && !column.loaded[i])
+            {
+                const pxl::Variant& record = candidates[i]->getUserRecord(column.key);
+                column.values[i] = column.boolean ? record.toBool() : record.toDouble();
+                column.loaded[i] = 1;
+            }
+        }
+    }
+    return column.values.data();
+}
+
+//separate loops per comparison so that each of them vectorises
+static void compareColumn(CutTest::Comparison comparison, double threshold, const double* values, unsigned size, unsigned char* mask)
+{
+    switch (comparison)
+    {
+        case CutTest::LESS:
+            for (unsigned i=0; i<size; ++i)
+            {
+                mask[i] = values[i]<threshold;
+            }
+            break;
+        case CutTest::LESS_EQUAL:
+            for (unsigned i=0; i<size; ++i)
+            {
+                mask[i] = values[i]<=threshold;
+            }
+            break;
+        case CutTest::GREATER:
+            for (unsigned i=0; i<size; ++i)
+            {
+                mask[i] = values[i]>threshold;
+            }
+            break;
+        case CutTest::GREATER_EQUAL:
+            for (unsigned i=0; i<size; ++i)
+            {
+                mask[i] = values[i]>=threshold;
+            }
+            break;
+        case CutTest::EQUAL:
+            for (unsigned i=0; i<size; ++i)
+            {
+                mask[i] = values[i]==threshold;
+            }
+            break;
+        case CutTest::NOT_EQUAL:
+            for (unsigned i=0; i<size; ++i)
+            {
+                mask[i] = values[i]!=threshold;
+            }
+            break;
+        case CutTest::IS_TRUE:
+            for (unsigned i=0; i<size; ++i)
+            {
+                mask[i] = values[i]!=0;
+            }
+            break;
+        case CutTest::IS_FALSE:
+            for (unsigned i=0; i<size; ++i)
+            {
+                mask[i] = values[i]==0;
+            }
+            break;
+        default:
+            for (unsigned i=0; i<size; ++i)
+            {
+                mask[i] = 0;
+            }
+    }
+}
+
+//mask[i] is set to 1 if the candidate is active and passes the test, inactive candidates are not accessed
+void CutEngine::evaluateColumns(const CutTest& cutTest, const std::vector<pxl::Particle*>& candidates, const std::vector<unsigned char>& active, std::vector<unsigned char>& mask)
+{
+    unsigned size = candidates.size();
+    mask.resize(size);
+    if (cutTest.comparison==CutTest::PREDICATE)
+    {
+        for (unsigned i=0; i<size; ++i)
+        {
+            mask[i] = active[i] && _predicates[cutTest.predicate](candidates[i]);
+        }
+        return;
+    }
+    _values.resize(size);
+    double* values = _values.data();
+    const double* numerator = getColumn(cutTest.numerator,candidates,active);
+    if (cutTest.numerator.absolute)
+    {
+        for (unsigned i=0; i<size; ++i)
+        {
+            values[i] = std::fabs(numerator[i]);
+        }
+    }
+    else
+    {
+        std::copy(numerator,numerator+size,values);
+    }
+    if (cutTest.denominator.source!=CutOperand::NONE)
+    {
+        const double* denominator = getColumn(cutTest.denominator,candidates,active);
+        if (cutTest.denominator.absolute)
+        {
+            for (unsigned i=0; i<size; ++i)
+            {
+                values[i] /= std::fabs(denominator[i]);
+            }
+        }
+        else
+        {
+            for (unsigned i=0; i<size; ++i)
+            {
+                values[i] /= denominator[i];
+            }
+        }
+    }
+    compareColumn(cutTest.comparison,cutTest.threshold,values,size,mask.data());
+    for (unsigned i=0; i<size; ++i)
+    {
+        mask[i] &= active[i];
+    }
+}
+
+void CutEngine::passBatch(const std::vector<pxl::Particle*>& candidates, std::vector<char>& result)
+{
+    unsigned size = candidates.size();
+    result.assign(size,0);
+    if (_adaptive && _cutFlow.getCandidates()>=_warmupCandidates)
+    {
+        adaptOrder();
+    }
+    if (_instrumented)
+    {
+        _cutFlow.beginCandidates(size);
+    }
+    loadColumns(candidates);
+    _alive.assign(size,1);
+    unsigned numAlive = size;
+    for (unsigned iorder=0; iorder<_order.size() && numAlive>0; ++iorder)
+    {
+        unsigned iop = _order[iorder];
+        const CutOp& op = _ops[iop];
+        uint64_t start = _instrumented ? readCycleCounter() : 0;
+        if (op.conditional)
+        {
+            //the cut itself is only evaluated where the condition holds
+            evaluateColumns(op.condition,candidates,_alive,_conditionMask);
+            evaluateColumns(op.test,candidates,_conditionMask,_mask);
+            for (unsigned i=0; i<size; ++i)
+            {
+                _alive[i] &= _mask[i] | (_conditionMask[i]^1);
+            }
+        }
+        else
+        {
+            evaluateColumns(op.test,candidates,_alive,_mask);
+            for (unsigned i=0; i<size; ++i)
+            {
+                _alive[i] &= _mask[i];
+            }
+        }
+        unsigned tested = numAlive;
+        numAlive = 0;
+        for (unsigned i=0; i<size; ++i)
+        {
+            numAlive += _alive[i];
+        }
+        if (_instrumented)
+        {
+            _cutFlow.count(iop,tested,numAlive);
+            _cutFlow.addCycles(iop,readCycleCounter()-start,tested);
+        }
+    }
+    for (unsigned i=0; i<size; ++i)
+    {
+        result[i] = _alive[i];
+    }
+    if (_instrumented)
+    {
+        _cutFlow.acceptCandidates(numAlive);
+    }
+}
@@ -0,0 +1,341 @@
+#ifndef _CUTENGINE_H_
+#define _CUTENGINE_H_
+
+#include "pxl/hep.hh"
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <cmath>
+
+#include "CutFlow.hpp"
+
+/*
+* Compiles a list of cuts like "pt > 26; abs(dxy) < 0.2; isPFMuon" into
+* typed predicate ops which are evaluated as a conjunction per particle.
+*
+* Syntax of a single cut:
+*   quantity <op> number        op: < <= > >= == !=
+*   record / !record            boolean user record
+*   name()                      predicate registered via addPredicate
+*   condition -> cut            cut is only applied if condition holds
+* A quantity is 'pt', 'eta', 'phi', 'energy', 'mass' or a user record, can be
+* wrapped in abs() and divided by another quantity, e.g. "dr03EcalRecHitSumEt/pt".
+*
+* For systematic variations 'pt', 'energy' and 'mass' can be evaluated with a
+* scale factor applied to the four-vector; records and predicates are unscaled.
+*/
+
+class CutOperand
+{
+    public:
+    enum Source
+    {
+        NONE,
+        PT,
+        ETA,
+        PHI,
+        ENERGY,
+        MASS,
+        RECORD
+    };
+
+    Source source;
+    std::string key;
+    bool absolute;
+    //column of the batch evaluation holding the quantity
+    int column;
+
+    CutOperand():
+        source(NONE),
+        absolute(false),
+        column(-1)
+    {
+    }
+
+    //true if the quantity changes with a scaled four-vector
+    inline bool isScaled() const
+    {
+        return source==PT || source==ENERGY || source==MASS;
+    }
+
+    inline double evaluate(pxl::Particle* particle, double scale=1.0) const
+    {
+        double value = 0;
+        switch (source)
+        {
+            case PT:
+                value = scale*particle->getPt();
+                break;
+            case ETA:
+                value = particle->getEta();
+                break;
+            case PHI:
+                value = particle->getPhi();
+                break;
+            case ENERGY:
+                value = scale*particle->getE();
+                break;
+            case MASS:
+                value = scale*particle->getMass();
+                break;
+            case RECORD:
+                value = particle->getUserRecord(key).toDouble();
+                break;
+            case NONE:
+                return 1.0;
+        }
+        return absolute ? fabs(value) : value;
+    }
+};
+
+class CutTest
+{
+    public:
+    enum Comparison
+    {
+        LESS,
+        LESS_EQUAL,
+        GREATER,
+        GREATER_EQUAL,
+        EQUAL,
+        NOT_EQUAL,
+        IS_TRUE,
+        IS_FALSE,
+        PREDICATE
+    };
+
+    CutOperand numerator;
+    CutOperand denominator;
+    Comparison comparison;
+    double threshold;
+    int predicate;
+
+    CutTest():
+        comparison(IS_TRUE),
+        threshold(0),
+        predicate(-1)
+    {
+    }
+
+    inline bool isScaled() const
+    {
+        return numerator.isScaled() || denominator.isScaled();
+    }
+
+    inline double evaluate(pxl::Particle* particle, double scale=1.0) const
+    {
+        if (denominator.source==CutOperand::NONE)
+        {
+            return numerator.evaluate(particle,scale);
+        }
+        return numerator.evaluate(particle,scale)/denominator.evaluate(particle,scale);
+    }
+
+    inline bool compare(double value) const
+    {
+        switch (comparison)
+        {
+            case LESS:
+                return value<threshold;
+            case LESS_EQUAL:
+                return value<=threshold;
+            case GREATER:
+                return value>threshold;
+            case GREATER_EQUAL:
+                return value>=threshold;
+            case EQUAL:
+                return value==threshold;
+            case NOT_EQUAL:
+                return value!=threshold;
+            default:
+                return false;
+        }
+    }
+};
+
+class CutEngine
+{
+    public:
+    typedef std::function<bool(pxl::Particle*)> Predicate;
+
+    private:
+    struct CutOp
+    {
+        std::string expression;
+        bool conditional;
+        bool scaled;
+        //looks up user records or calls a predicate, which may do so
+        bool record;
+        CutTest condition;
+        CutTest test;
+    };
+
+    std::vector<CutOp> _ops;
+    //evaluation order of the ops, the cut flow is always kept in source order
+    std::vector<unsigned> _order;
+    std::vector<std::string> _predicateNames;
+    std::vector<Predicate> _predicates;
+
+    bool _instrumented;
+    bool _reportCutFlow;
+    CutFlow _cutFlow;
+
+    bool _adaptive;
+    uint64_t _warmupCandidates;
+
+    //one quantity of all candidates of an event
+    struct Column
+    {
+        CutOperand::Source source;
+        std::string key;
+        bool boolean;
+        std::vector<double> values;
+        //records are only looked up for the candidates reaching a cut on them
+        std::vector<unsigned char> loaded;
+    };
+
+    //buffers of the batch evaluation, reused between events
+    bool _batch;
+    std::vector<Column> _columns;
+    std::vector<unsigned char> _alive;
+    std::vector<unsigned char> _mask;
+    std::vector<unsigned char> _conditionMask;
+    std::vector<double> _values;
+
+    int addColumn(const CutOperand& operand, bool boolean);
+    void assignColumns(CutTest& cutTest);
+    void loadColumns(const std::vector<pxl::Particle*>& candidates);
+    const double* getColumn(const CutOperand& operand, const std::vector<pxl::Particle*>& candidates, const std::vector<unsigned char>& active);
+    void evaluateColumns(const CutTest& cutTest, const std::vector<pxl::Particle*>& candidates, const std::vector<unsigned char>& active, std::vector<unsigned char>& mask);
+    void passBatch(const std::vector<pxl::Particle*>& candidates, std::vector<char>& result);
+
+    void adaptOrder();
+
+    CutTest parseTest(const std::string& expression) const;
+
+    inline bool test(const CutOp& op, pxl::Particle* particle, double scale=1.0) const
+    {
+        if (op.conditional && not test(op.condition,particle,scale))
+        {
+            return true;
+        }
+        return test(op.test,particle,scale);
+    }
+
+    bool passInstrumented(pxl::Particle* particle);
+
+    inline bool test(const CutTest& cutTest, pxl::Particle* particle, double scale=1.0) const
+    {
+        switch (cutTest.comparison)
+        {
+            case CutTest::IS_TRUE:
+                return particle->getUserRecord(cutTest.numerator.key).toBool();
+            case CutTest::IS_FALSE:
+                return not particle->getUserRecord(cutTest.numerator.key).toBool();
+            case CutTest::PREDICATE:
+                return _predicates[cutTest.predicate](particle);
+            default:
+                return cutTest.compare(cutTest.evaluate(particle,scale));
+        }
+    }
+
+    public:
+    CutEngine():
+        _instrumented(false),
+        _reportCutFlow(false),
+        _adaptive(false),
+        _warmupCandidates(0),
+        _batch(false)
+    {
+    }
+
+    //needs to be called before compile for all predicates referenced by name()
+    void addPredicate(const std::string& name, Predicate predicate);
+
+    void compile(const std::string& cuts) throw (std::runtime_error);
+
+    //keep per cut pass counts and sampled cycle counts, call after compile
+    void enableCutFlow(const std::string& name);
+
+    /*
+    * Measure rejection rate and cost of each cut for the given number of
+    * candidates (at least 1) and afterwards evaluate the cuts ordered by
+    * rejection/cost. Cuts without a measurement keep their position. A cut
+    * looking up user records or calling a predicate stays behind all cuts
+    * written before it, so it only sees candidates which reached it in the
+    * fixed order: a record is never looked up where the fixed order did not
+    * and the results are identical.
+    */
+    void enableAdaptiveOrder(uint64_t warmupCandidates) throw (std::runtime_error);
+
+    /*
+    * Evaluate whole collections cut by cut. Each quantity referenced by the
+    * cuts is read once per event into a contiguous column: the kinematic
+    * ones for all candidates up front, user records on the first cut using
+    * them for the candidates still alive, so that no record is looked up
+    * where the candidate by candidate evaluation would not. Every cut is
+    * then a branch free loop over the columns updating a mask of the alive
+    * candidates, which the compiler vectorises.
+    */
+    void setBatchEvaluation(bool batch)
+    {
+        _batch = batch;
+    }
+
+    //result[i] is set to 1 if candidates[i] passes all cuts
+    void pass(const std::vector<pxl::Particle*>& candidates, std::vector<char>& result);
+
+    inline bool pass(pxl::Particle* particle)
+    {
+        if (_instrumented)
+        {
+            return passInstrumented(particle);
+        }
+        for (unsigned iop=0; iop<_order.size(); ++iop)
+        {
+            if (not test(_ops[_order[iop]],particle))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*
+    * Evaluate the cuts for several scale factors of the four-vector at once:
+    * cuts not depending on the scale are tested only once and the remaining
+    * ones per scale. result[i] is set to 1 if the particle passes with
+    * scales[i]. If the particle is known to pass all cuts unscaled, e.g.
+    * from pass() for the nominal selection, passedUnscaled skips the cuts
+    * not depending on the scale. The cut flow is not updated.
+    */
+    void passScaled(pxl::Particle* particle, const std::vector<double>& scales, std::vector<char>& result, bool passedUnscaled=false) const;
+
+    //true if any cut depends on the scale of the four-vector
+    bool isScaled() const;
+
+    unsigned size() const
+    {
+        return _ops.size();
+    }
+
+    const std::string& getExpression(unsigned index) const
+    {
+        return _ops[index].expression;
+    }
+
+    //index of the op evaluated at the given position
+    unsigned getOrder(unsigned position) const
+    {
+        return _order[position];
+    }
+
+    const CutFlow& getCutFlow() const
+    {
+        return _cutFlow;
+    }
+};
+
+#endif
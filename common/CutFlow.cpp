@@ -0,0 +1,111 @@
+#include "CutFlow.hpp"
+
+#include <cstdio>
+#include <iostream>
+#include <fstream>
+#include <stdexcept>
+
+CutFlow::CutFlow():
+    _candidates(0),
+    _accepted(0),
+    _samplingPeriod(16),
+    _sampleCounter(0)
+{
+}
+
+void CutFlow::reset(const std::string& name, const std::vector<std::string>& cuts, unsigned samplingPeriod)
+{
+    _name = name;
+    _entries.clear();
+    for (unsigned icut=0; icut<cuts.size(); ++icut)
+    {
+        Entry entry;
+        entry.name = cuts[icut];
+        entry.tested = 0;
+        entry.passed = 0;
+        entry.sampled = 0;
+        entry.cycles = 0;
+        _entries.push_back(entry);
+    }
+    _candidates = 0;
+    _accepted = 0;
+    _samplingPeriod = samplingPeriod>0 ? samplingPeriod : 1;
+    _sampleCounter = 0;
+}
+
+static double ratio(uint64_t numerator, uint64_t denominator)
+{
+    return denominator>0 ? 1.0*numerator/denominator : 0.0;
+}
+
+void CutFlow::print(std::ostream& os, const std::string& title) const
+{
+    char buf[300];
+    sprintf(buf,"%s - %s cut flow: %lu candidates, %lu accepted",title.c_str(),_name.c_str(),(unsigned long)_candidates,(unsigned long)_accepted);
+    os<<buf<<std::endl;
+    sprintf(buf,"  %-60s %12s %12s %7s %10s","cut","tested","passed","eff.","cycles");
+    os<<buf<<std::endl;
+    for (unsigned ientry=0; ientry<_entries.size(); ++ientry)
+    {
+        const Entry& entry = _entries[ientry];
+        sprintf(buf,"  %-60.60s %12lu %12lu %7.4f %10.1f",entry.name.c_str(),(unsigned long)entry.tested,(unsigned long)entry.passed,ratio(entry.passed,entry.tested),ratio(entry.cycles,entry.sampled));
+        os<<buf<<std::endl;
+    }
+}
+
+static std::string escapeJSON(const std::string& s)
+{
+    std::string result;
+    for (unsigned ichar=0; ichar<s.size(); ++ichar)
+    {
+        if (s[ichar]=='"' || s[ichar]=='\\')
+        {
+            result+='\\';
+        }
+        result+=s[ichar];
+    }
+    return result;
+}
+
+void CutFlow::writeJSON(std::ostream& os, const std::string& module, const std::vector<const CutFlow*>& cutFlows)
+{
+    os<<"{\n  \"module\": \""<<escapeJSON(module)<<"\",\n  \"cutflows\": [";
+    for (unsigned icutFlow=0; icutFlow<cutFlows.size(); ++icutFlow)
+    {
+        const CutFlow* cutFlow = cutFlows[icutFlow];
+        os<<(icutFlow>0 ? "," : "")<<"\n    {\n";
+        os<<"      \"name\": \""<<escapeJSON(cutFlow->_name)<<"\",\n";
+        os<<"      \"candidates\": "<<cutFlow->_candidates<<",\n";
+        os<<"      \"accepted\": "<<cutFlow->_accepted<<",\n";
+        os<<"      \"cuts\": [";
+        for (unsigned ientry=0; ientry<cutFlow->_entries.size(); ++ientry)
+        {
+            const Entry& entry = cutFlow->_entries[ientry];
+            os<<(ientry>0 ? "," : "")<<"\n        {";
+            os<<"\"cut\": \""<<escapeJSON(entry.name)<<"\", ";
+            os<<"\"tested\": "<<entry.tested<<", ";
+            os<<"\"passed\": "<<entry.passed<<", ";
+            os<<"\"sampled\": "<<entry.sampled<<", ";
+            os<<"\"cycles\": "<<entry.cycles<<"}";
+        }
+        os<<"\n      ]\n    }";
+    }
+    os<<"\n  ]\n}\n";
+}
+
+void CutFlow::report(const std::string& module, const std::string& fileName, const std::vector<const CutFlow*>& cutFlows)
+{
+    for (unsigned icutFlow=0; icutFlow<cutFlows.size(); ++icutFlow)
+    {
+        cutFlows[icutFlow]->print(std::cout,module);
+    }
+    if (fileName.size()>0)
+    {
+        std::ofstream ofs(fileName.c_str(), std::ofstream::out);
+        if (!ofs.is_open())
+        {
+            throw std::runtime_error("cannot open cut flow file '"+fileName+"'");
+        }
+        writeJSON(ofs,module,cutFlows);
+    }
+}
@@ -0,0 +1,132 @@
+#ifndef _CUTFLOW_H_
+#define _CUTFLOW_H_
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+inline uint64_t readCycleCounter()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+/*
+* Pass counts and sampled cycle counts per cut. The counters belong to a
+* single module instance which is only ever run by one thread, so they are
+* updated without any synchronisation. Timing is only taken for every n-th
+* candidate to keep the overhead small enough for production runs.
+*/
+class CutFlow
+{
+    public:
+    struct Entry
+    {
+        std::string name;
+        uint64_t tested;
+        uint64_t passed;
+        uint64_t sampled;
+        uint64_t cycles;
+    };
+
+    private:
+    std::string _name;
+    std::vector<Entry> _entries;
+    uint64_t _candidates;
+    uint64_t _accepted;
+    unsigned _samplingPeriod;
+    unsigned _sampleCounter;
+
+    public:
+    CutFlow();
+
+    void reset(const std::string& name, const std::vector<std::string>& cuts, unsigned samplingPeriod=16);
+
+    //returns true if the current candidate should be timed
+    inline bool beginCandidate()
+    {
+        ++_candidates;
+        if (++_sampleCounter>=_samplingPeriod)
+        {
+            _sampleCounter=0;
+            return true;
+        }
+        return false;
+    }
+
+    inline void acceptCandidate()
+    {
+        ++_accepted;
+    }
+
+    //batches are always timed as a whole
+    inline void beginCandidates(unsigned candidates)
+    {
+        _candidates+=candidates;
+    }
+
+    inline void acceptCandidates(unsigned candidates)
+    {
+        _accepted+=candidates;
+    }
+
+    inline void count(unsigned index, bool passed)
+    {
+        Entry& entry = _entries[index];
+        ++entry.tested;
+        entry.passed+=passed;
+    }
+
+    inline void count(unsigned index, unsigned tested, unsigned passed)
+    {
+        Entry& entry = _entries[index];
+        entry.tested+=tested;
+        entry.passed+=passed;
+    }
+
+    inline void addCycles(unsigned index, uint64_t cycles, unsigned samples=1)
+    {
+        Entry& entry = _entries[index];
+        entry.sampled+=samples;
+        entry.cycles+=cycles;
+    }
+
+    const std::string& getName() const
+    {
+        return _name;
+    }
+
+    const std::vector<Entry>& getEntries() const
+    {
+        return _entries;
+    }
+
+    uint64_t getCandidates() const
+    {
+        return _candidates;
+    }
+
+    uint64_t getAccepted() const
+    {
+        return _accepted;
+    }
+
+    void print(std::ostream& os, const std::string& title) const;
+
+    static void writeJSON(std::ostream& os, const std::string& module, const std::vector<const CutFlow*>& cutFlows);
+
+    //prints all cut flows and writes them as JSON if a file name is given
+    static void report(const std::string& module, const std::string& fileName, const std::vector<const CutFlow*>& cutFlows);
+};
+
+#endif
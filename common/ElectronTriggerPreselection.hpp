@@ -0,0 +1,155 @@
+#ifndef _ELECTRONTRIGGERPRESELECTION_H_
+#define _ELECTRONTRIGGERPRESELECTION_H_
+
+#include "pxl/hep.hh"
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <cstdlib>
+
+/*
+* Emulation of the electron trigger identification. The thresholds are kept
+* in a table binned in |superClusterEta|, configured as a ';' separated
+* list of bins
+*
+*   <max |eta|> <sigmaIetaIeta> <hadronicOverEm> <track iso> <ecal iso> <hcal iso> <max lost hits>
+*
+* with increasing upper edges, the last one may be 'inf'; the isolations
+* are relative to pt. getDefaultBins() holds the barrel (<1.479) and endcap
+* thresholds. A candidate is looked up in its bin and the checks run from
+* the cheapest and most rejecting ones, the shower shape and H/E, to the
+* isolations, stopping at the first failure.
+*
+* The samples store the track isolation either as dr03TkSumP (old
+* reprocessing) or as dr03TkSumPt. The key is resolved once from the first
+* candidate and kept until reset() is called at the beginning of the job.
+*/
+class ElectronTriggerPreselection
+{
+    private:
+    struct EtaBin
+    {
+        double maxAbsEta;
+        double sigmaIetaIeta;
+        double hadronicOverEm;
+        //relative isolation thresholds, divided by pt
+        double trackIsolation;
+        double ecalIsolation;
+        double hcalIsolation;
+        int maxLostHits;
+    };
+
+    std::vector<EtaBin> _bins;
+    std::string _trackIsolationKey;
+
+    public:
+    ElectronTriggerPreselection()
+    {
+        parseBins(getDefaultBins());
+    }
+
+    //barrel and endcap thresholds of the trigger identification
+    static const char* getDefaultBins()
+    {
+        return "1.479 0.014 0.15 0.2 0.2 0.2 0; inf 0.035 0.10 0.2 0.2 0.2 0";
+    }
+
+    void parseBins(const std::string& bins) throw (std::runtime_error)
+    {
+        std::vector<EtaBin> parsed;
+        size_t begin = 0;
+        while (begin<=bins.size())
+        {
+            size_t end = bins.find(';',begin);
+            if (end==std::string::npos)
+            {
+                end = bins.size();
+            }
+            const std::string bin = bins.substr(begin,end-begin);
+            begin = end+1;
+            if (bin.find_first_not_of(" \t")==std::string::npos)
+            {
+                continue;
+            }
+            //strtod also reads 'inf'
+            double values[7];
+            const char* position = bin.c_str();
+            char* next = 0;
+            for (unsigned ivalue=0; ivalue<7; ++ivalue)
+            {
+                values[ivalue] = strtod(position,&next);
+                if (next==position)
+                {
+                    throw std::runtime_error("cannot parse electron trigger preselection bin '"+bin+"', expected '<max |eta|> <sigmaIetaIeta> <hadronicOverEm> <track iso> <ecal iso> <hcal iso> <max lost hits>'");
+                }
+                position = next;
+            }
+            if (std::string(position).find_first_not_of(" \t")!=std::string::npos)
+            {
+                throw std::runtime_error("trailing characters in electron trigger preselection bin '"+bin+"'");
+            }
+            if (!parsed.empty() && !(values[0]>parsed.back().maxAbsEta))
+            {
+                throw std::runtime_error("eta bins of the electron trigger preselection need to be increasing");
+            }
+            EtaBin etaBin = {values[0],values[1],values[2],values[3],values[4],values[5],int(values[6])};
+            parsed.push_back(etaBin);
+        }
+        if (parsed.empty())
+        {
+            throw std::runtime_error("electron trigger preselection needs at least one eta bin");
+        }
+        _bins.swap(parsed);
+    }
+
+    //forgets the resolved isolation key, to be called once per job
+    void reset()
+    {
+        _trackIsolationKey.clear();
+    }
+
+    bool operator()(pxl::Particle* particle)
+    {
+        if (_trackIsolationKey.empty())
+        {
+            _trackIsolationKey = particle->hasUserRecord("dr03TkSumP") ? "dr03TkSumP" : "dr03TkSumPt";
+        }
+        const double absEta = fabs(particle->getUserRecord("superClusterEta").toFloat());
+        unsigned ibin = 0;
+        for (unsigned i=0; i+1<_bins.size(); ++i)
+        {
+            ibin += absEta>=_bins[i].maxAbsEta;
+        }
+        const EtaBin& bin = _bins[ibin];
+        if (not (absEta<bin.maxAbsEta))
+        {
+            return false;
+        }
+        if (not (particle->getUserRecord("sigmaIetaIeta").toFloat()<bin.sigmaIetaIeta))
+        {
+            return false;
+        }
+        if (not (particle->getUserRecord("hadronicOverEm").toFloat()<bin.hadronicOverEm))
+        {
+            return false;
+        }
+        const double pt = particle->getPt();
+        if (not (particle->getUserRecord(_trackIsolationKey).toFloat()/pt<bin.trackIsolation))
+        {
+            return false;
+        }
+        if (not (particle->getUserRecord("dr03EcalRecHitSumEt").toFloat()/pt<bin.ecalIsolation))
+        {
+            return false;
+        }
+        if (not (particle->getUserRecord("dr03HcalTowerSumEt").toFloat()/pt<bin.hcalIsolation))
+        {
+            return false;
+        }
+        return particle->getUserRecord("numberOfLostHits").toInt32()<=bin.maxLostHits;
+    }
+};
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef _ETAPHIGRID_H_
+#define _ETAPHIGRID_H_
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+/*
+* Bins objects into eta-phi cells so that a cone search only has to look at
+* the neighbouring cells instead of all objects. The cells are at least as
+* large as the cell size in both directions, phi wraps around and objects
+* beyond the eta range are put into the outermost cells. Cells are cleared
+* lazily, so refilling the grid per event only touches the cells in use.
+*/
+template<class T> class EtaPhiGrid
+{
+    public:
+    struct Entry
+    {
+        double eta;
+        double phi;
+        T value;
+    };
+
+    private:
+    double _etaMax;
+    double _etaCellSize;
+    double _phiCellSize;
+    int _numEta;
+    int _numPhi;
+    std::vector<std::vector<Entry> > _cells;
+    std::vector<int> _usedCells;
+
+    inline int etaIndex(double eta) const
+    {
+        int index = (int)std::floor((eta+_etaMax)/_etaCellSize);
+        return index<0 ? 0 : (index>=_numEta ? _numEta-1 : index);
+    }
+
+    inline int phiIndex(double phi) const
+    {
+        int index = (int)std::floor((phi+M_PI)/_phiCellSize);
+        index%=_numPhi;
+        return index<0 ? index+_numPhi : index;
+    }
+
+    public:
+    EtaPhiGrid(double cellSize=0.4, double etaMax=5.0)
+    {
+        configure(cellSize,etaMax);
+    }
+
+    void configure(double cellSize, double etaMax)
+    {
+        _etaMax = etaMax;
+        _numEta = std::max(1,(int)std::floor(2.0*etaMax/cellSize));
+        _numPhi = std::max(1,(int)std::floor(2.0*M_PI/cellSize));
+        _etaCellSize = 2.0*etaMax/_numEta;
+        _phiCellSize = 2.0*M_PI/_numPhi;
+        _cells.assign(_numEta*_numPhi,std::vector<Entry>());
+        _usedCells.clear();
+    }
+
+    void clear()
+    {
+        for (unsigned icell=0; icell<_usedCells.size(); ++icell)
+        {
+            _cells[_usedCells[icell]].clear();
+        }
+        _usedCells.clear();
+    }
+
+    void insert(double eta, double phi, const T& value)
+    {
+        int cell = etaIndex(eta)*_numPhi+phiIndex(phi);
+        if (_cells[cell].empty())
+        {
+            _usedCells.push_back(cell);
+        }
+        Entry entry;
+        entry.eta = eta;
+        entry.phi = phi;
+        entry.value = value;
+        _cells[cell].push_back(entry);
+    }
+
+    static inline double deltaR2(double eta1, double phi1, double eta2, double phi2)
+    {
+        double deta = eta1-eta2;
+        double dphi = std::fabs(phi1-phi2);
+        if (dphi>M_PI)
+        {
+            dphi = 2.0*M_PI-dphi;
+        }
+        return deta*deta+dphi*dphi;
+    }
+
+    //calls visit(entry, deltaR) for all entries within the radius
+    template<class Visitor> void visitNeighbours(double eta, double phi, double radius, Visitor visit) const
+    {
+        int etaRange = (int)std::ceil(radius/_etaCellSize);
+        int phiRange = (int)std::ceil(radius/_phiCellSize);
+        int centerEta = etaIndex(eta);
+        int centerPhi = phiIndex(phi);
+        int etaBegin = std::max(0,centerEta-etaRange);
+        int etaEnd = std::min(_numEta-1,centerEta+etaRange);
+        int phiBegin = centerPhi-phiRange;
+        int phiEnd = centerPhi+phiRange;
+        if (phiEnd-phiBegin+1>=_numPhi)
+        {
+            //the cone covers all phi cells, visit each one only once
+            phiBegin = 0;
+            phiEnd = _numPhi-1;
+        }
+        double radius2 = radius*radius;
+        for (int ieta=etaBegin; ieta<=etaEnd; ++ieta)
+        {
+            for (int iphi=phiBegin; iphi<=phiEnd; ++iphi)
+            {
+                int wrappedPhi = (iphi+_numPhi)%_numPhi;
+                const std::vector<Entry>& cell = _cells[ieta*_numPhi+wrappedPhi];
+                for (unsigned ientry=0; ientry<cell.size(); ++ientry)
+                {
+                    const Entry& entry = cell[ientry];
+                    double dr2 = deltaR2(eta,phi,entry.eta,entry.phi);
+                    if (dr2<radius2)
+                    {
+                        visit(entry,std::sqrt(dr2));
+                    }
+                }
+            }
+        }
+    }
+};
+
+#endif
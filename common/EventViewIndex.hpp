@@ -0,0 +1,88 @@
+#ifndef _EVENTVIEWINDEX_H_
+#define _EVENTVIEWINDEX_H_
+
+#include "pxl/core.hh"
+#include "pxl/hep.hh"
+
+#include <string>
+#include <vector>
+
+/*
+* Name to event view lookup of the current event, built at the start of
+* every analyse call with a single pass over the object owner of the
+* event. It is not a cache: each module still scans the event once per
+* call, the index is not shared between modules and it is not kept across
+* events. What it saves are the allocations, since the buffers are reused
+* and after the first events none happen, and the repeated scans when a
+* module looks up several view names of the same event.
+*
+* Keeping the index beyond the call would need an identity of the event:
+* an event read or copied later can reuse the address and the Id of a
+* previous one, and pxl cannot store a pointer in a user record to attach
+* the index to the event itself.
+*/
+class EventViewIndex
+{
+    private:
+    struct Entry
+    {
+        std::string name;
+        std::vector<pxl::EventView*> eventViews;
+    };
+
+    std::vector<Entry> _entries;
+    unsigned _numEntries;
+    std::vector<pxl::EventView*> _none;
+
+    public:
+    EventViewIndex():
+        _numEntries(0)
+    {
+    }
+
+    void build(const pxl::Event* event)
+    {
+        _numEntries = 0;
+        const pxl::ObjectOwner& objects = event->getObjectOwner();
+        for (pxl::ObjectOwner::const_iterator object=objects.begin(); object!=objects.end(); ++object)
+        {
+            pxl::EventView* eventView = dynamic_cast<pxl::EventView*>(*object);
+            if (!eventView)
+            {
+                continue;
+            }
+            const std::string& name = eventView->getName();
+            unsigned ientry = 0;
+            while (ientry<_numEntries && _entries[ientry].name!=name)
+            {
+                ++ientry;
+            }
+            if (ientry==_numEntries)
+            {
+                if (_numEntries==_entries.size())
+                {
+                    _entries.push_back(Entry());
+                }
+                _entries[ientry].name = name;
+                _entries[ientry].eventViews.clear();
+                ++_numEntries;
+            }
+            _entries[ientry].eventViews.push_back(eventView);
+        }
+    }
+
+    //all event views with the given name in the order they are stored in the event
+    const std::vector<pxl::EventView*>& get(const std::string& name) const
+    {
+        for (unsigned ientry=0; ientry<_numEntries; ++ientry)
+        {
+            if (_entries[ientry].name==name)
+            {
+                return _entries[ientry].eventViews;
+            }
+        }
+        return _none;
+    }
+};
+
+#endif
@@ -0,0 +1,131 @@
+#include "MultiplicityRouter.hpp"
+
+#include <cstdlib>
+#include <climits>
+#include <algorithm>
+
+MultiplicityRouter::MultiplicityRouter():
+    _overflow(-1),
+    _outer(0)
+{
+}
+
+static std::string trim(const std::string& s)
+{
+    size_t begin = s.find_first_not_of(" \t");
+    if (begin==std::string::npos)
+    {
+        return "";
+    }
+    size_t end = s.find_last_not_of(" \t");
+    return s.substr(begin,end-begin+1);
+}
+
+static int parseCount(const std::string& s, const std::string& bin) throw (std::runtime_error)
+{
+    char* end = 0;
+    long value = strtol(s.c_str(),&end,10);
+    if (s.empty() || *end!='\0' || value<0 || value>100000)
+    {
+        throw std::runtime_error("invalid multiplicity bin '"+bin+"'");
+    }
+    return int(value);
+}
+
+void MultiplicityRouter::parse(const std::string& bins, const std::string& unit) throw (std::runtime_error)
+{
+    _bins.clear();
+    _sources.clear();
+    _table.clear();
+    _overflow = -1;
+    _outer = 0;
+
+    int tableSize = 0;
+    size_t begin = 0;
+    while (begin<=bins.size())
+    {
+        size_t end = bins.find(',',begin);
+        if (end==std::string::npos)
+        {
+            end = bins.size();
+        }
+        std::string token = trim(bins.substr(begin,end-begin));
+        begin = end+1;
+        if (token.empty())
+        {
+            continue;
+        }
+        Bin bin;
+        bin.label = token+" "+unit;
+        if (token.compare(0,2,">=")==0)
+        {
+            bin.min = parseCount(trim(token.substr(2)),token);
+            bin.max = INT_MAX;
+        } else if (token[0]=='>') {
+            bin.min = parseCount(trim(token.substr(1)),token)+1;
+            bin.max = INT_MAX;
+        } else if (token.find('-')!=std::string::npos) {
+            size_t dash = token.find('-');
+            bin.min = parseCount(trim(token.substr(0,dash)),token);
+            bin.max = parseCount(trim(token.substr(dash+1)),token);
+            if (bin.max<bin.min)
+            {
+                throw std::runtime_error("invalid multiplicity bin '"+token+"'");
+            }
+        } else {
+            bin.min = parseCount(token,token);
+            bin.max = bin.min;
+        }
+        for (unsigned ibin=0; ibin<_bins.size(); ++ibin)
+        {
+            if (bin.min<=_bins[ibin].max && _bins[ibin].min<=bin.max)
+            {
+                throw std::runtime_error("multiplicity bins '"+_bins[ibin].label+"' and '"+bin.label+"' overlap");
+            }
+        }
+        tableSize = std::max(tableSize,(bin.max==INT_MAX ? bin.min : bin.max)+1);
+        _bins.push_back(bin);
+    }
+    if (_bins.empty())
+    {
+        throw std::runtime_error("no multiplicity bins given");
+    }
+
+    _table.assign(tableSize,-1);
+    for (unsigned ibin=0; ibin<_bins.size(); ++ibin)
+    {
+        const Bin& bin = _bins[ibin];
+        for (int multiplicity=bin.min; multiplicity<tableSize && multiplicity<=bin.max; ++multiplicity)
+        {
+            _table[multiplicity] = ibin;
+        }
+        if (bin.max==INT_MAX)
+        {
+            _overflow = ibin;
+        }
+    }
+    _sources.assign(_bins.size(),0);
+}
+
+void MultiplicityRouter::addSources(pxl::Module* module)
+{
+    for (unsigned ibin=_bins.size(); ibin>0; --ibin)
+    {
+        const std::string& label = _bins[ibin-1].label;
+        _sources[ibin-1] = module->addSource(label,label);
+    }
+}
+
+void MultiplicityRouter::addSources(pxl::Module* module, const MultiplicityRouter& outer)
+{
+    _outer = &outer;
+    _sources.assign(outer.size()*_bins.size(),0);
+    for (unsigned iouter=outer.size(); iouter>0; --iouter)
+    {
+        for (unsigned ibin=_bins.size(); ibin>0; --ibin)
+        {
+            const std::string label = outer.getLabel(iouter-1)+", "+_bins[ibin-1].label;
+            _sources[(iouter-1)*_bins.size()+ibin-1] = module->addSource(label,label);
+        }
+    }
+}
@@ -0,0 +1,110 @@
+#ifndef _MULTIPLICITYROUTER_H_
+#define _MULTIPLICITYROUTER_H_
+
+#include "pxl/core.hh"
+#include "pxl/modules/Module.hh"
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+/*
+* Routes events to sources by an object multiplicity. The bins are given
+* as a ',' separated list like "0,1,2-3,>=4" where a bin is either a single
+* count 'n', a range 'a-b' or an open bin '>n' / '>=n'. Each bin gets a
+* source named "<bin> <unit>", e.g. "2-3 jets". Events whose multiplicity
+* is not covered by any bin are dropped without being dispatched.
+*
+* The counts are resolved through a lookup table so routing costs a single
+* index operation per event.
+*
+* Routing on a pair of multiplicities, like the jet selection followed by
+* the bjet selection, creates one source per pair of bins named
+* "<outer bin> <outer unit>, <bin> <unit>", e.g. "4 jets, 2 bjets".
+*/
+class MultiplicityRouter
+{
+    private:
+    struct Bin
+    {
+        int min;
+        int max;
+        std::string label;
+    };
+
+    std::vector<Bin> _bins;
+    std::vector<pxl::Source*> _sources;
+    //bin index per multiplicity, -1 if not covered
+    std::vector<int> _table;
+    //bin of all multiplicities beyond the table
+    int _overflow;
+    //bins of the first multiplicity when routing on pairs, otherwise 0
+    const MultiplicityRouter* _outer;
+
+    public:
+    MultiplicityRouter();
+
+    void parse(const std::string& bins, const std::string& unit) throw (std::runtime_error);
+
+    //creates one source per bin, highest bin first like the fixed sources before
+    void addSources(pxl::Module* module);
+
+    //creates one source per pair of an outer bin and a bin, the outer router needs to outlive this one
+    void addSources(pxl::Module* module, const MultiplicityRouter& outer);
+
+    unsigned size() const
+    {
+        return _bins.size();
+    }
+
+    const std::string& getLabel(unsigned index) const
+    {
+        return _bins[index].label;
+    }
+
+    //returns -1 if the multiplicity is not covered
+    inline int getBin(int multiplicity) const
+    {
+        return multiplicity>=0 && multiplicity<int(_table.size()) ? _table[multiplicity] : (multiplicity<0 ? -1 : _overflow);
+    }
+
+    //returns 0 if the multiplicity is not routed
+    inline pxl::Source* route(int multiplicity) const
+    {
+        int bin = getBin(multiplicity);
+        return bin>=0 ? _sources[bin] : 0;
+    }
+
+    //routing on pairs, returns 0 if either multiplicity is not covered
+    inline pxl::Source* route(int outerMultiplicity, int multiplicity) const
+    {
+        int outerBin = _outer->getBin(outerMultiplicity);
+        int bin = getBin(multiplicity);
+        return outerBin>=0 && bin>=0 ? _sources[outerBin*_bins.size()+bin] : 0;
+    }
+
+    //sets the targets and processes them; events outside the bins are accepted and dropped
+    inline bool process(int multiplicity, pxl::Serializable* event) const
+    {
+        pxl::Source* source = route(multiplicity);
+        if (!source)
+        {
+            return true;
+        }
+        source->setTargets(event);
+        return source->processTargets();
+    }
+
+    inline bool process(int outerMultiplicity, int multiplicity, pxl::Serializable* event) const
+    {
+        pxl::Source* source = route(outerMultiplicity,multiplicity);
+        if (!source)
+        {
+            return true;
+        }
+        source->setTargets(event);
+        return source->processTargets();
+    }
+};
+
+#endif
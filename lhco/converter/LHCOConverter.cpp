@@ -7,6 +7,11 @@
 
 #include "LHCO/LHCO.hpp"
 
+#include <memory>
+
+#include "ShardedOutput.hpp"
+#include "EventViewIndex.hpp"
+
 static pxl::Logger logger("LHCOConverter");
 
 class LHCOConverter : public pxl::Module
@@ -14,10 +19,15 @@ class LHCOConverter : public pxl::Module
     private:
     pxl::Source* _output;
 
-    std::ofstream* ofs;
+    //closed in endJob, or on destruction if the job is aborted
+    std::unique_ptr<ShardedOutput> _shardedOutput;
 
     std::string _outFileName;
+    int64_t _numShards;
+    std::string _shardMode;
+    bool _orderedMerge;
     std::string _inputEventViewName;
+    EventViewIndex _eventViewIndex;
 
     std::string _jetName;
     std::string _bjetName;
@@ -32,6 +42,9 @@ class LHCOConverter : public pxl::Module
     LHCOConverter() :
         Module(),
         _outFileName("input.lhco"),
+        _numShards(1),
+        _shardMode("round robin"),
+        _orderedMerge(false),
         _inputEventViewName("Reconstructed"),
         _jetName("SelectedJet"),
         _bjetName("SelectedBJet"),
@@ -45,6 +58,9 @@ class LHCOConverter : public pxl::Module
         _output = addSource("output", "output");
 
         addOption("output file","name of the lhco output file",_outFileName,pxl::OptionDescription::USAGE_FILE_SAVE);
+        addOption("shards","number of output files written in parallel, each shard gets the index appended to the file name",_numShards);
+        addOption("shard mode","distribution of events over the shards: 'round robin' or 'event id'",_shardMode);
+        addOption("ordered merge","merge the shards into the output file preserving the original event sequence",_orderedMerge);
 
         addOption("event view","name of the event view used to build the lhco event",_inputEventViewName);
         addOption("jet name","name of jets",_jetName);
@@ -86,6 +102,9 @@ class LHCOConverter : public pxl::Module
     void beginJob() throw (std::runtime_error)
     {
         getOption("output file",_outFileName);
+        getOption("shards",_numShards);
+        getOption("shard mode",_shardMode);
+        getOption("ordered merge",_orderedMerge);
 
         getOption("event view",_inputEventViewName);
         getOption("jet name",_jetName);
@@ -95,12 +114,29 @@ class LHCOConverter : public pxl::Module
         getOption("photon name",_metName);
         getOption("met name",_photonName);
 
-        ofs = new std::ofstream(_outFileName, std::ofstream::out);
+        ShardedOutput::Mode mode = ShardedOutput::ROUND_ROBIN;
+        if (_shardMode=="event id")
+        {
+            mode = ShardedOutput::EVENT_ID;
+        }
+        else if (_shardMode!="round robin")
+        {
+            throw std::runtime_error("unknown shard mode '"+_shardMode+"'");
+        }
+        if (_numShards<1 || _numShards>ShardedOutput::MAX_SHARDS)
+        {
+            throw std::runtime_error("number of shards needs to be between 1 and 65535");
+        }
+        _shardedOutput.reset(new ShardedOutput(_outFileName,_numShards,mode,_orderedMerge));
     }
 
     void endJob()
     {
-        ofs->close();
+        if (_shardedOutput)
+        {
+            _shardedOutput->close();
+            _shardedOutput.reset();
+        }
     }
 
     bool analyse(pxl::Sink *sink) throw (std::runtime_error)
@@ -111,88 +147,84 @@ class LHCOConverter : public pxl::Module
             if (event)
             {
                 int numJets=0;
-                std::vector<pxl::EventView*> eventViews;
-                event->getObjectsOfType(eventViews);
+                _eventViewIndex.build(event);
+                const std::vector<pxl::EventView*>& eventViews = _eventViewIndex.get(_inputEventViewName);
                 for (unsigned ieventView=0; ieventView<eventViews.size();++ieventView)
                 {
                     pxl::EventView* eventView = eventViews[ieventView];
-                    if (eventView->getName()==_inputEventViewName)
-                    {
-                        ++_eventCount;
-                        LHCOEvent lhcoEvent;
+                    ++_eventCount;
+                    LHCOEvent lhcoEvent;
 
-                        lhcoEvent.setEventID(event->getUserRecord("Event number").toUInt32());
-                        std::vector<pxl::Particle*> particles;
-                        eventView->getObjectsOfType(particles);
-                        for (unsigned iparticle=0; iparticle<particles.size();++iparticle)
+                    uint32_t eventID = event->getUserRecord("Event number").toUInt32();
+                    lhcoEvent.setEventID(eventID);
+                    std::vector<pxl::Particle*> particles;
+                    eventView->getObjectsOfType(particles);
+                    for (unsigned iparticle=0; iparticle<particles.size();++iparticle)
+                    {
+                        pxl::Particle* particle = particles[iparticle];
+                        if (particle->getName()==_jetName)
                         {
-                            pxl::Particle* particle = particles[iparticle];
-                            if (particle->getName()==_jetName)
-                            {
-                                lhcoEvent.addJet(
-                                    particle->getEta(),//eta=0.0,
-                                    particle->getPhi(),//phi=0.0,
-                                    particle->getPt(),//pt=0.0,
-                                    particle->getMass()//mass=0.0,
-                                    //ntrk=0.0,
-                                    //dummy1=0.0,
-                                    //dummy2=0.0
-                                );
-                            } else if (particle->getName()==_bjetName) {
-                                lhcoEvent.addBJet(
-                                    particle->getEta(),//eta=0.0,
-                                    particle->getPhi(),//phi=0.0,
-                                    particle->getPt(),//pt=0.0,
-                                    particle->getMass()//mass=0.0,
-                                    //ntrk=0.0,
-                                    //dummy1=0.0,
-                                    //dummy2=0.0
-                                );
-                            } else if (particle->getName()==_electronName) {
-                                lhcoEvent.addElectron(
-                                    particle->getEta(),//eta=0.0,
-                                    particle->getPhi(),//phi=0.0,
-                                    particle->getPt(),//pt=0.0,
-                                    (int)particle->getCharge()//int charge=-1,
-                                    //float dummy1=0.0,
-                                    //float dummy2=0.0
-                                );
-                            } else if (particle->getName()==_muonName) {
-                                lhcoEvent.addMuon(
-                                    particle->getEta(),//eta=0.0,
-                                    particle->getPhi(),//phi=0.0,
-                                    particle->getPt(),//pt=0.0,
-                                    (int)particle->getCharge()//int charge=-1,
-                                    //float dummy1=0.0,
-                                    //float dummy2=0.0
-                                );
-                            } else if (particle->getName()==_photonName) {
-                                lhcoEvent.addPhoton(
-                                    particle->getEta(),//eta=0.0,
-                                    particle->getPhi(),//phi=0.0,
-                                    particle->getPt()//pt=0.0,
-                                    //float hademfraction=0.0,
-                                    //float dummy1=0.0,
-                                    //float dummy2=0.0
-                                );
-                            } else if (particle->getName()==_metName) {
-                                lhcoEvent.setMET(
-                                    particle->getPhi(),//phi=0.0,
-                                    particle->getPt()//pt=0.0,
-                                    //float dummy1=0.0,
-                                    //float dummy2=0.0
-                                );
-                            }
+                            lhcoEvent.addJet(
+                                particle->getEta(),//eta=0.0,
+                                particle->getPhi(),//phi=0.0,
+                                particle->getPt(),//pt=0.0,
+                                particle->getMass()//mass=0.0,
+                                //ntrk=0.0,
+                                //dummy1=0.0,
+                                //dummy2=0.0
+                            );
+                        } else if (particle->getName()==_bjetName) {
+                            lhcoEvent.addBJet(
+                                particle->getEta(),//eta=0.0,
+                                particle->getPhi(),//phi=0.0,
+                                particle->getPt(),//pt=0.0,
+                                particle->getMass()//mass=0.0,
+                                //ntrk=0.0,
+                                //dummy1=0.0,
+                                //dummy2=0.0
+                            );
+                        } else if (particle->getName()==_electronName) {
+                            lhcoEvent.addElectron(
+                                particle->getEta(),//eta=0.0,
+                                particle->getPhi(),//phi=0.0,
+                                particle->getPt(),//pt=0.0,
+                                (int)particle->getCharge()//int charge=-1,
+                                //float dummy1=0.0,
+                                //float dummy2=0.0
+                            );
+                        } else if (particle->getName()==_muonName) {
+                            lhcoEvent.addMuon(
+                                particle->getEta(),//eta=0.0,
+                                particle->getPhi(),//phi=0.0,
+                                particle->getPt(),//pt=0.0,
+                                (int)particle->getCharge()//int charge=-1,
+                                //float dummy1=0.0,
+                                //float dummy2=0.0
+                            );
+                        } else if (particle->getName()==_photonName) {
+                            lhcoEvent.addPhoton(
+                                particle->getEta(),//eta=0.0,
+                                particle->getPhi(),//phi=0.0,
+                                particle->getPt()//pt=0.0,
+                                //float hademfraction=0.0,
+                                //float dummy1=0.0,
+                                //float dummy2=0.0
+                            );
+                        } else if (particle->getName()==_metName) {
+                            lhcoEvent.setMET(
+                                particle->getPhi(),//phi=0.0,
+                                particle->getPt()//pt=0.0,
+                                //float dummy1=0.0,
+                                //float dummy2=0.0
+                            );
                         }
-                        char* buf = new char[50];
-                        sprintf(buf,"num event: %i",_eventCount);
-                        lhcoEvent.setComment(buf);
-                        delete buf;
-                        lhcoEvent.writeComment(*ofs);
-                        //lhcoEvent.writeSummary(*ofs);
-                        lhcoEvent.writeEvent(*ofs);
-
                     }
+                    char buf[50];
+                    sprintf(buf,"num event: %i",_eventCount);
+                    lhcoEvent.setComment(buf);
+                    //lhcoEvent.writeSummary(*ofs);
+                    _shardedOutput->write(lhcoEvent,eventID);
+
                 }
 
                 _output->setTargets(event);
@@ -214,6 +246,8 @@ class LHCOConverter : public pxl::Module
 
     void shutdown() throw(std::runtime_error)
     {
+        //joins the writer threads if endJob was not reached
+        _shardedOutput.reset();
     }
 
     void destroy() throw (std::runtime_error)
@@ -0,0 +1,225 @@
+#include "ShardedOutput.hpp"
+
+#include <stdexcept>
+#include <cstdio>
+
+static const size_t MAX_QUEUED_EVENTS = 4096;
+static const size_t FLUSH_BUFFER_SIZE = 1<<20;
+
+LHCOShard::LHCOShard(const std::string& fileName, bool recordSizes):
+    _fileName(fileName),
+    _ofs(fileName, std::ofstream::out),
+    _finished(false),
+    _recordSizes(recordSizes)
+{
+    if (!_ofs.is_open())
+    {
+        throw std::runtime_error("cannot open lhco output file '"+fileName+"'");
+    }
+    _thread = std::thread(&LHCOShard::run,this);
+}
+
+LHCOShard::~LHCOShard()
+{
+    close();
+}
+
+void LHCOShard::push(const LHCOEvent& lhcoEvent)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    //apply back pressure if the writer falls behind
+    _condition.wait(lock,[this]{return _queue.size()<MAX_QUEUED_EVENTS;});
+    _queue.push_back(lhcoEvent);
+    lock.unlock();
+    _condition.notify_all();
+}
+
+void LHCOShard::run()
+{
+    std::deque<LHCOEvent> batch;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condition.wait(lock,[this]{return _finished || !_queue.empty();});
+            if (_queue.empty() && _finished)
+            {
+                break;
+            }
+            batch.swap(_queue);
+        }
+        _condition.notify_all();
+
+        for (unsigned ievent=0; ievent<batch.size(); ++ievent)
+        {
+            std::streamoff start = _buffer.tellp();
+            batch[ievent].writeComment(_buffer);
+            batch[ievent].writeEvent(_buffer);
+            if (_recordSizes)
+            {
+                _eventSizes.push_back(_buffer.tellp()-start);
+            }
+            if (_buffer.tellp()>=(std::streamoff)FLUSH_BUFFER_SIZE)
+            {
+                flush();
+            }
+        }
+        batch.clear();
+    }
+    flush();
+}
+
+void LHCOShard::flush()
+{
+    const std::string& content = _buffer.str();
+    _ofs.write(content.data(),content.size());
+    _buffer.str("");
+    _buffer.clear();
+}
+
+void LHCOShard::close()
+{
+    if (!_thread.joinable())
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _finished=true;
+    }
+    _condition.notify_all();
+    _thread.join();
+    _ofs.close();
+}
+
+const std::string& LHCOShard::getFileName() const
+{
+    return _fileName;
+}
+
+const std::vector<uint64_t>& LHCOShard::getEventSizes() const
+{
+    return _eventSizes;
+}
+
+ShardedOutput::ShardedOutput(const std::string& fileName, unsigned numShards, Mode mode, bool ordered):
+    _fileName(fileName),
+    _mode(mode),
+    _ordered(ordered),
+    _count(0)
+{
+    if (numShards==0 || numShards>MAX_SHARDS)
+    {
+        throw std::runtime_error("number of lhco shards out of range");
+    }
+    if (numShards==1 && !_ordered)
+    {
+        _ofs.reset(new std::ofstream(_fileName, std::ofstream::out));
+        if (!_ofs->is_open())
+        {
+            throw std::runtime_error("cannot open lhco output file '"+_fileName+"'");
+        }
+        return;
+    }
+    for (unsigned ishard=0; ishard<numShards; ++ishard)
+    {
+        _shards.push_back(std::unique_ptr<LHCOShard>(new LHCOShard(getShardFileName(_fileName,ishard),_ordered)));
+    }
+}
+
+ShardedOutput::~ShardedOutput()
+{
+    close();
+}
+
+std::string ShardedOutput::getShardFileName(const std::string& fileName, unsigned shard)
+{
+    char buf[20];
+    sprintf(buf,"_%u",shard);
+    size_t dot = fileName.rfind('.');
+    size_t slash = fileName.rfind('/');
+    if (dot==std::string::npos || (slash!=std::string::npos && dot<slash))
+    {
+        return fileName+buf;
+    }
+    return fileName.substr(0,dot)+buf+fileName.substr(dot);
+}
+
+unsigned ShardedOutput::selectShard(uint32_t eventID) const
+{
+    if (_mode==EVENT_ID)
+    {
+        //mix the bits so that consecutive event numbers spread over all shards
+        uint32_t hash = eventID*2654435761u;
+        return (hash^(hash>>16))%_shards.size();
+    }
+    return _count%_shards.size();
+}
+
+void ShardedOutput::write(LHCOEvent& lhcoEvent, uint32_t eventID)
+{
+    if (_ofs)
+    {
+        lhcoEvent.writeComment(*_ofs);
+        lhcoEvent.writeEvent(*_ofs);
+        ++_count;
+        return;
+    }
+    unsigned shard = selectShard(eventID);
+    if (_ordered)
+    {
+        _eventShard.push_back(shard);
+    }
+    _shards[shard]->push(lhcoEvent);
+    ++_count;
+}
+
+void ShardedOutput::merge()
+{
+    std::ofstream ofs(_fileName, std::ofstream::out);
+    std::vector<std::ifstream*> inputs;
+    std::vector<unsigned> cursors(_shards.size(),0);
+    for (unsigned ishard=0; ishard<_shards.size(); ++ishard)
+    {
+        inputs.push_back(new std::ifstream(_shards[ishard]->getFileName(), std::ifstream::in));
+    }
+    std::vector<char> block;
+    for (unsigned ievent=0; ievent<_eventShard.size(); ++ievent)
+    {
+        unsigned shard = _eventShard[ievent];
+        uint64_t size = _shards[shard]->getEventSizes()[cursors[shard]++];
+        block.resize(size);
+        inputs[shard]->read(block.data(),size);
+        ofs.write(block.data(),size);
+    }
+    for (unsigned ishard=0; ishard<_shards.size(); ++ishard)
+    {
+        delete inputs[ishard];
+        std::remove(_shards[ishard]->getFileName().c_str());
+    }
+    ofs.close();
+}
+
+void ShardedOutput::close()
+{
+    if (_ofs)
+    {
+        _ofs->close();
+        _ofs.reset();
+        return;
+    }
+    if (_shards.empty())
+    {
+        return;
+    }
+    for (unsigned ishard=0; ishard<_shards.size(); ++ishard)
+    {
+        _shards[ishard]->close();
+    }
+    if (_ordered)
+    {
+        merge();
+    }
+    _shards.clear();
+    _eventShard.clear();
+}
@@ -0,0 +1,88 @@
+#ifndef _SHARDEDOUTPUT_H_
+#define _SHARDEDOUTPUT_H_
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <sstream>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <cstdint>
+
+#include "LHCO/LHCO.hpp"
+
+//one output file with its own formatting buffer and writer thread
+class LHCOShard
+{
+    private:
+        std::string _fileName;
+        std::ofstream _ofs;
+        std::ostringstream _buffer;
+
+        std::deque<LHCOEvent> _queue;
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        std::thread _thread;
+        bool _finished;
+
+        //byte size of every formatted event, only kept for the ordered merge
+        bool _recordSizes;
+        std::vector<uint64_t> _eventSizes;
+
+        void run();
+        void flush();
+
+    public:
+        LHCOShard(const std::string& fileName, bool recordSizes);
+        ~LHCOShard();
+
+        void push(const LHCOEvent& lhcoEvent);
+        void close();
+
+        const std::string& getFileName() const;
+        const std::vector<uint64_t>& getEventSizes() const;
+};
+
+class ShardedOutput
+{
+    public:
+        enum Mode
+        {
+            ROUND_ROBIN,
+            EVENT_ID
+        };
+
+        //the shard of each event is stored in 16 bits for the ordered merge
+        static const unsigned MAX_SHARDS = 0xffff;
+
+    private:
+        std::string _fileName;
+        Mode _mode;
+        bool _ordered;
+
+        //owning, so the started writer threads are joined even if a later shard cannot be opened
+        std::vector<std::unique_ptr<LHCOShard>> _shards;
+        //shard of each written event in input order, only kept for the ordered merge
+        std::vector<uint16_t> _eventShard;
+        uint64_t _count;
+
+        //single shard without merge is written directly from the calling thread
+        std::unique_ptr<std::ofstream> _ofs;
+
+        unsigned selectShard(uint32_t eventID) const;
+        void merge();
+
+    public:
+        ShardedOutput(const std::string& fileName, unsigned numShards, Mode mode, bool ordered);
+        ~ShardedOutput();
+
+        void write(LHCOEvent& lhcoEvent, uint32_t eventID);
+        void close();
+
+        static std::string getShardFileName(const std::string& fileName, unsigned shard);
+};
+
+#endif
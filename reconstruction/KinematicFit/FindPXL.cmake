@@ -0,0 +1 @@
+../../FindPXL.cmake
\ No newline at end of file
@@ -0,0 +1,316 @@
+#include "pxl/hep.hh"
+#include "pxl/core.hh"
+#include "pxl/core/macros.hh"
+#include "pxl/core/PluginManager.hh"
+#include "pxl/modules/Module.hh"
+#include "pxl/modules/ModuleFactory.hh"
+
+#include "EventViewIndex.hpp"
+#include "KinematicFitter.hpp"
+#include "ResolutionTable.hpp"
+
+#include <cmath>
+
+static pxl::Logger logger("KinematicFit");
+
+/*
+* Kinematic fit of the leptonic top quark candidates written by
+* TopReconstruction. The lepton, neutrino and b-jet are taken from the
+* decay tree of each top, the MET of the event view is the measurement of
+* the neutrino transverse momentum. Converged fits are written as a tree
+* of fitted particles named with the fitted prefix, e.g. FittedTop with the
+* daughters FittedW and FittedSelectedBJet. The original top gets the
+* records fitConverged and, for converged fits, fitChi2.
+*/
+class KinematicFit : public pxl::Module
+{
+    private:
+    pxl::Source* _output;
+
+    std::string _inputEventViewName;
+    EventViewIndex _eventViewIndex;
+    std::string _topName;
+    std::string _wName;
+    std::string _neutrinoName;
+    std::string _metName;
+    std::string _fittedPrefix;
+    std::string _resolutionFileName;
+
+    double _wMass;
+    double _topMass;
+    int64_t _maxIterations;
+
+    KinematicFitter _fitter;
+    ResolutionTable _resolutions;
+
+    std::vector<pxl::Particle*> _daughters;
+    std::vector<pxl::Particle*> _wDaughters;
+
+    public:
+    KinematicFit() :
+        Module(),
+        _inputEventViewName("Reconstructed"),
+        _topName("Top"),
+        _wName("W"),
+        _neutrinoName("Neutrino"),
+        _metName("MET"),
+        _fittedPrefix("Fitted"),
+        _resolutionFileName(""),
+        _wMass(80.38),
+        _topMass(172.5),
+        _maxIterations(20)
+    {
+        addSink("input", "Input");
+        _output = addSource("output", "output");
+
+        addOption("event view","name of the event view",_inputEventViewName);
+        addOption("top name","name of the top quark candidates to fit",_topName);
+        addOption("w name","name of the W daughter of the top",_wName);
+        addOption("neutrino name","name of the neutrino daughter of the W",_neutrinoName);
+        addOption("met name","name of the MET, the neutrino px,py are used if missing",_metName);
+        addOption("fitted prefix","prefix of the names of the fitted particles",_fittedPrefix);
+        addOption("resolution file","optional table of the pt resolutions, see ResolutionTable.hpp for the format; built-in resolutions if empty",_resolutionFileName,pxl::OptionDescription::USAGE_FILE_OPEN);
+        addOption("w mass","W mass constraint",_wMass);
+        addOption("top mass","top mass constraint",_topMass);
+        addOption("max iterations","maximum number of iterations per fit",_maxIterations);
+    }
+
+    ~KinematicFit()
+    {
+    }
+
+    // every Module needs a unique type
+    static const std::string &getStaticType()
+    {
+        static std::string type ("KinematicFit");
+        return type;
+    }
+
+    // static and dynamic methods are needed
+    const std::string &getType() const
+    {
+        return getStaticType();
+    }
+
+    bool isRunnable() const
+    {
+        // this module does not provide events, so return false
+        return false;
+    }
+
+    void initialize() throw (std::runtime_error)
+    {
+    }
+
+    void beginJob() throw (std::runtime_error)
+    {
+        getOption("event view",_inputEventViewName);
+        getOption("top name",_topName);
+        getOption("w name",_wName);
+        getOption("neutrino name",_neutrinoName);
+        getOption("met name",_metName);
+        getOption("fitted prefix",_fittedPrefix);
+        getOption("resolution file",_resolutionFileName);
+        getOption("w mass",_wMass);
+        getOption("top mass",_topMass);
+        getOption("max iterations",_maxIterations);
+
+        if (_maxIterations<1)
+        {
+            throw std::runtime_error("max iterations needs to be at least 1");
+        }
+        _fitter.setWMass(_wMass);
+        _fitter.setTopMass(_topMass);
+        _fitter.setMaxIterations(_maxIterations);
+        _resolutions = ResolutionTable();
+        if (_resolutionFileName.size()>0)
+        {
+            _resolutions.load(_resolutionFileName);
+        }
+    }
+
+    void endJob()
+    {
+    }
+
+    pxl::Particle* createFitted(pxl::EventView* eventView, const std::string& name, const double* vector) const
+    {
+        pxl::Particle* fitted = eventView->create<pxl::Particle>();
+        fitted->setName(_fittedPrefix+name);
+        pxl::LorentzVector p4;
+        p4.setXYZ(vector[0],vector[1],vector[2]);
+        p4.setE(vector[3]);
+        fitted->setP4(p4);
+        return fitted;
+    }
+
+    void fit(pxl::EventView* eventView, pxl::Particle* top, const pxl::Particle* met)
+    {
+        pxl::Particle* w = 0;
+        pxl::Particle* bjet = 0;
+        _daughters.clear();
+        top->getDaughterRelations().getObjectsOfType(_daughters);
+        for (unsigned idaughter=0; idaughter<_daughters.size(); ++idaughter)
+        {
+            if (_daughters[idaughter]->getName()==_wName)
+            {
+                w = _daughters[idaughter];
+            }
+            else
+            {
+                bjet = _daughters[idaughter];
+            }
+        }
+        if (!w || !bjet)
+        {
+            return;
+        }
+        pxl::Particle* lepton = 0;
+        pxl::Particle* neutrino = 0;
+        _wDaughters.clear();
+        w->getDaughterRelations().getObjectsOfType(_wDaughters);
+        for (unsigned idaughter=0; idaughter<_wDaughters.size(); ++idaughter)
+        {
+            if (_wDaughters[idaughter]->getName()==_neutrinoName)
+            {
+                neutrino = _wDaughters[idaughter];
+            }
+            else
+            {
+                lepton = _wDaughters[idaughter];
+            }
+        }
+        if (!lepton || !neutrino || !(lepton->getPt()>0) || !(bjet->getPt()>0))
+        {
+            return;
+        }
+
+        KinematicFitter::Input input;
+        const double leptonPt = lepton->getPt();
+        const double leptonP = std::sqrt(leptonPt*leptonPt + lepton->getPz()*lepton->getPz());
+        input.leptonDirection[0] = lepton->getPx()/leptonPt;
+        input.leptonDirection[1] = lepton->getPy()/leptonPt;
+        input.leptonDirection[2] = lepton->getPz()/leptonPt;
+        input.leptonDirection[3] = leptonP/leptonPt;
+        const double bjetPt = bjet->getPt();
+        input.bjetDirection[0] = bjet->getPx()/bjetPt;
+        input.bjetDirection[1] = bjet->getPy()/bjetPt;
+        input.bjetDirection[2] = bjet->getPz()/bjetPt;
+        input.bjetDirection[3] = bjet->getE()/bjetPt;
+
+        const double metPx = met ? met->getPx() : neutrino->getPx();
+        const double metPy = met ? met->getPy() : neutrino->getPy();
+        const double metSigma = _resolutions.getResolution(ResolutionTable::MET,std::sqrt(metPx*metPx + metPy*metPy),0.0);
+        input.measured[KinematicFitter::LEPTON_PT] = leptonPt;
+        input.measured[KinematicFitter::BJET_PT] = bjetPt;
+        input.measured[KinematicFitter::NEUTRINO_PX] = metPx;
+        input.measured[KinematicFitter::NEUTRINO_PY] = metPy;
+        input.measured[KinematicFitter::NEUTRINO_PZ] = neutrino->getPz();
+        input.sigma[KinematicFitter::LEPTON_PT] = _resolutions.getResolution(ResolutionTable::LEPTON,leptonPt,std::fabs(lepton->getEta()));
+        input.sigma[KinematicFitter::BJET_PT] = _resolutions.getResolution(ResolutionTable::JET,bjetPt,std::fabs(bjet->getEta()));
+        input.sigma[KinematicFitter::NEUTRINO_PX] = metSigma;
+        input.sigma[KinematicFitter::NEUTRINO_PY] = metSigma;
+        input.sigma[KinematicFitter::NEUTRINO_PZ] = 0.0;
+
+        KinematicFitter::Result result;
+        const bool converged = _fitter.fit(input,result);
+        top->setUserRecord("fitConverged",converged);
+        if (!converged)
+        {
+            return;
+        }
+        top->setUserRecord("fitChi2",result.chi2);
+
+        double leptonVector[4];
+        double bjetVector[4];
+        double neutrinoVector[4];
+        _fitter.getFourVectors(input,result,leptonVector,bjetVector,neutrinoVector);
+        double wVector[4];
+        double topVector[4];
+        for (int k=0; k<4; ++k)
+        {
+            wVector[k] = leptonVector[k]+neutrinoVector[k];
+            topVector[k] = wVector[k]+bjetVector[k];
+        }
+
+        pxl::Particle* fittedLepton = createFitted(eventView,lepton->getName(),leptonVector);
+        fittedLepton->setCharge(lepton->getCharge());
+        pxl::Particle* fittedNeutrino = createFitted(eventView,neutrino->getName(),neutrinoVector);
+        pxl::Particle* fittedBJet = createFitted(eventView,bjet->getName(),bjetVector);
+        pxl::Particle* fittedW = createFitted(eventView,w->getName(),wVector);
+        fittedW->setCharge(w->getCharge());
+        fittedW->linkDaughter(fittedLepton);
+        fittedW->linkDaughter(fittedNeutrino);
+        pxl::Particle* fittedTop = createFitted(eventView,top->getName(),topVector);
+        fittedTop->setCharge(top->getCharge());
+        fittedTop->linkDaughter(fittedW);
+        fittedTop->linkDaughter(fittedBJet);
+        fittedTop->setUserRecord("fitChi2",result.chi2);
+        //one degree of freedom: two constraints and the unmeasured neutrino pz
+        fittedTop->setUserRecord("fitProbability",erfc(std::sqrt(result.chi2/2)));
+        fittedTop->setUserRecord("fitIterations",result.iterations);
+    }
+
+    bool analyse(pxl::Sink *sink) throw (std::runtime_error)
+    {
+        try
+        {
+            pxl::Event *event  = dynamic_cast<pxl::Event *> (sink->get());
+            if (event)
+            {
+                _eventViewIndex.build(event);
+                const std::vector<pxl::EventView*>& eventViews = _eventViewIndex.get(_inputEventViewName);
+                for (unsigned ieventView=0; ieventView<eventViews.size();++ieventView)
+                {
+                    pxl::EventView* eventView = eventViews[ieventView];
+                    std::vector<pxl::Particle*> particles;
+                    eventView->getObjectsOfType(particles);
+                    pxl::Particle* met = 0;
+                    std::vector<pxl::Particle*> tops;
+                    for (unsigned iparticle=0; iparticle<particles.size();++iparticle)
+                    {
+                        pxl::Particle* particle = particles[iparticle];
+                        if (particle->getName()==_topName)
+                        {
+                            tops.push_back(particle);
+                        }
+                        else if (met==0 && particle->getName()==_metName)
+                        {
+                            met = particle;
+                        }
+                    }
+                    for (unsigned itop=0; itop<tops.size(); ++itop)
+                    {
+                        fit(eventView,tops[itop],met);
+                    }
+                }
+
+                _output->setTargets(event);
+                return _output->processTargets();
+            }
+        }
+        catch(std::exception &e)
+        {
+            throw std::runtime_error(getName()+": "+e.what());
+        }
+        catch(...)
+        {
+            throw std::runtime_error(getName()+": unknown exception");
+        }
+
+        logger(pxl::LOG_LEVEL_ERROR , "Analysed event is not an pxl::Event !");
+        return false;
+    }
+
+    void shutdown() throw(std::runtime_error)
+    {
+    }
+
+    void destroy() throw (std::runtime_error)
+    {
+        delete this;
+    }
+};
+
+PXL_MODULE_INIT(KinematicFit)
+PXL_PLUGIN_INIT
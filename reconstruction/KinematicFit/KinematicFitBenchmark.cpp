@@ -0,0 +1,243 @@
+/*
+* Benchmark and convergence check of the KinematicFitter. Leptonic top
+* quark decays t -> b W, W -> l nu are generated from a seeded generator
+* with the masses of the constraints, the lepton pt, b-jet pt and MET are
+* smeared with the built-in resolutions of the ResolutionTable and the
+* neutrino pz is started from the W mass constraint like in NeutrinoPz.
+* The inputs are built as in the KinematicFit module.
+*
+* Reports the fraction of converged fits, the mean chi2 of the converged
+* fits for one degree of freedom and the number of fits per second on one
+* core. The check fails if fewer than 90% of the fits converge, if the mean
+* chi2 is outside [0.5,2] or if fewer than 10000 fits per second are done.
+*
+* usage: KinematicFitBenchmark [number of events] [seed]
+*
+* The random numbers are drawn from std::mt19937_64 and transformed without
+* the std distributions, so the sample is the same with every standard
+* library.
+*/
+
+#include "KinematicFitter.hpp"
+#include "ResolutionTable.hpp"
+
+#include <random>
+#include <chrono>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+class Generator
+{
+    private:
+    std::mt19937_64 _engine;
+
+    public:
+    Generator(unsigned long seed) : _engine(seed)
+    {
+    }
+
+    //uniform in [0,1) with 53 random bits
+    double uniform()
+    {
+        return (_engine()>>11)*(1.0/9007199254740992.0);
+    }
+
+    double uniform(double min, double max)
+    {
+        return min + (max-min)*uniform();
+    }
+
+    //Box-Muller, one of the two numbers is dropped to keep the sequence simple
+    double gauss(double mean, double sigma)
+    {
+        const double u1 = 1.0-uniform();
+        const double u2 = uniform();
+        return mean + sigma*std::sqrt(-2*std::log(u1))*std::cos(2*M_PI*u2);
+    }
+
+    //isotropic momentum of the given magnitude and energy, px, py, pz, E
+    void isotropic(double p, double e, double* vector)
+    {
+        const double cosTheta = uniform(-1,1);
+        const double sinTheta = std::sqrt(1-cosTheta*cosTheta);
+        const double phi = uniform(-M_PI,M_PI);
+        vector[0] = p*sinTheta*std::cos(phi);
+        vector[1] = p*sinTheta*std::sin(phi);
+        vector[2] = p*cosTheta;
+        vector[3] = e;
+    }
+};
+
+//boosts the vector from the rest frame of 'frame' into the frame 'frame' is given in
+static void boost(const double* frame, double* vector)
+{
+    const double bx = frame[0]/frame[3];
+    const double by = frame[1]/frame[3];
+    const double bz = frame[2]/frame[3];
+    const double b2 = bx*bx + by*by + bz*bz;
+    const double gamma = 1/std::sqrt(1-b2);
+    const double bp = bx*vector[0] + by*vector[1] + bz*vector[2];
+    const double gamma2 = b2>0 ? (gamma-1)/b2 : 0;
+    vector[0] += gamma2*bp*bx + gamma*bx*vector[3];
+    vector[1] += gamma2*bp*by + gamma*by*vector[3];
+    vector[2] += gamma2*bp*bz + gamma*bz*vector[3];
+    vector[3] = gamma*(vector[3] + bp);
+}
+
+static double pt(const double* vector)
+{
+    return std::sqrt(vector[0]*vector[0] + vector[1]*vector[1]);
+}
+
+static double absEta(const double* vector)
+{
+    return std::fabs(std::asinh(vector[2]/pt(vector)));
+}
+
+//two body decay of 'mother' into daughters of the given masses, isotropic in the rest frame
+static void decay(Generator& generator, const double* mother, double mass, double mass1, double mass2, double* daughter1, double* daughter2)
+{
+    const double sum = mass1+mass2;
+    const double difference = mass1-mass2;
+    const double p = std::sqrt((mass*mass-sum*sum)*(mass*mass-difference*difference))/(2*mass);
+    generator.isotropic(p,std::sqrt(p*p+mass1*mass1),daughter1);
+    for (int k=0; k<3; ++k)
+    {
+        daughter2[k] = -daughter1[k];
+    }
+    daughter2[3] = std::sqrt(p*p+mass2*mass2);
+    boost(mother,daughter1);
+    boost(mother,daughter2);
+}
+
+//start value of the neutrino pz from the W mass constraint, smaller |pz| or the real part
+static double neutrinoPz(const double* lepton, double metPx, double metPy, double wMass)
+{
+    const double mu = wMass*wMass/2 + metPx*lepton[0] + metPy*lepton[1];
+    const double denominator = lepton[3]*lepton[3] - lepton[2]*lepton[2];
+    const double a = mu*lepton[2]/denominator;
+    const double b = (lepton[3]*lepton[3]*(metPx*metPx + metPy*metPy) - mu*mu)/denominator;
+    const double radicand = a*a-b;
+    if (radicand<0)
+    {
+        return a;
+    }
+    const double root = std::sqrt(radicand);
+    return std::fabs(a+root)<std::fabs(a-root) ? a+root : a-root;
+}
+
+static void generateSample(std::vector<KinematicFitter::Input>& sample, long numEvents, unsigned long seed, double wMass, double topMass)
+{
+    const double bMass = 4.8;
+    Generator generator(seed);
+    ResolutionTable resolutions;
+    while (long(sample.size())<numEvents)
+    {
+        double top[4];
+        const double topPt = std::fabs(generator.gauss(0,80));
+        const double topEta = generator.uniform(-2.4,2.4);
+        const double topPhi = generator.uniform(-M_PI,M_PI);
+        top[0] = topPt*std::cos(topPhi);
+        top[1] = topPt*std::sin(topPhi);
+        top[2] = topPt*std::sinh(topEta);
+        top[3] = std::sqrt(top[0]*top[0] + top[1]*top[1] + top[2]*top[2] + topMass*topMass);
+
+        double w[4], bjet[4], lepton[4], neutrino[4];
+        decay(generator,top,topMass,wMass,bMass,w,bjet);
+        decay(generator,w,wMass,0.0,0.0,lepton,neutrino);
+
+        //acceptance of the selection
+        if (pt(lepton)<20 || absEta(lepton)>2.5 || pt(bjet)<25 || absEta(bjet)>2.4)
+        {
+            continue;
+        }
+
+        const double leptonPt = pt(lepton);
+        const double bjetPt = pt(bjet);
+        const double leptonSigma = resolutions.getResolution(ResolutionTable::LEPTON,leptonPt,absEta(lepton));
+        const double bjetSigma = resolutions.getResolution(ResolutionTable::JET,bjetPt,absEta(bjet));
+        const double metSigma = resolutions.getResolution(ResolutionTable::MET,pt(neutrino),0.0);
+        const double measuredLeptonPt = leptonPt + generator.gauss(0,leptonSigma);
+        const double measuredBJetPt = bjetPt + generator.gauss(0,bjetSigma);
+        const double metPx = neutrino[0] + generator.gauss(0,metSigma);
+        const double metPy = neutrino[1] + generator.gauss(0,metSigma);
+        if (!(measuredLeptonPt>0) || !(measuredBJetPt>0))
+        {
+            continue;
+        }
+
+        KinematicFitter::Input input;
+        for (int k=0; k<4; ++k)
+        {
+            input.leptonDirection[k] = lepton[k]/leptonPt;
+            input.bjetDirection[k] = bjet[k]/bjetPt;
+        }
+        double measuredLepton[4];
+        for (int k=0; k<4; ++k)
+        {
+            measuredLepton[k] = input.leptonDirection[k]*measuredLeptonPt;
+        }
+        const double measuredMetSigma = resolutions.getResolution(ResolutionTable::MET,std::sqrt(metPx*metPx + metPy*metPy),0.0);
+        input.measured[KinematicFitter::LEPTON_PT] = measuredLeptonPt;
+        input.measured[KinematicFitter::BJET_PT] = measuredBJetPt;
+        input.measured[KinematicFitter::NEUTRINO_PX] = metPx;
+        input.measured[KinematicFitter::NEUTRINO_PY] = metPy;
+        input.measured[KinematicFitter::NEUTRINO_PZ] = neutrinoPz(measuredLepton,metPx,metPy,wMass);
+        input.sigma[KinematicFitter::LEPTON_PT] = resolutions.getResolution(ResolutionTable::LEPTON,measuredLeptonPt,absEta(lepton));
+        input.sigma[KinematicFitter::BJET_PT] = resolutions.getResolution(ResolutionTable::JET,measuredBJetPt,absEta(bjet));
+        input.sigma[KinematicFitter::NEUTRINO_PX] = measuredMetSigma;
+        input.sigma[KinematicFitter::NEUTRINO_PY] = measuredMetSigma;
+        input.sigma[KinematicFitter::NEUTRINO_PZ] = 0.0;
+        sample.push_back(input);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const long numEvents = argc>1 ? std::max(1L,atol(argv[1])) : 100000;
+    const unsigned long seed = argc>2 ? strtoul(argv[2],0,10) : 12345;
+    const double wMass = 80.38;
+    const double topMass = 172.5;
+    const double minConvergedFraction = 0.9;
+    const double minFitsPerSecond = 10000;
+
+    std::vector<KinematicFitter::Input> sample;
+    generateSample(sample,numEvents,seed,wMass,topMass);
+
+    KinematicFitter fitter(wMass,topMass);
+    std::vector<KinematicFitter::Result> results(sample.size());
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned ievent=0; ievent<sample.size(); ++ievent)
+    {
+        fitter.fit(sample[ievent],results[ievent]);
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+
+    long numConverged = 0;
+    double sumChi2 = 0;
+    double sumIterations = 0;
+    for (unsigned ievent=0; ievent<results.size(); ++ievent)
+    {
+        if (results[ievent].converged)
+        {
+            ++numConverged;
+            sumChi2 += results[ievent].chi2;
+            sumIterations += results[ievent].iterations;
+        }
+    }
+    const double convergedFraction = double(numConverged)/results.size();
+    const double meanChi2 = numConverged>0 ? sumChi2/numConverged : 0;
+    const double fitsPerSecond = results.size()/seconds;
+
+    printf("fits:                     %lu\n",results.size());
+    printf("converged:                %.2f%%\n",100*convergedFraction);
+    printf("mean chi2 (converged):    %.3f\n",meanChi2);
+    printf("mean iterations:          %.2f\n",numConverged>0 ? sumIterations/numConverged : 0);
+    printf("fits per second:          %.3g\n",fitsPerSecond);
+
+    const bool pass = convergedFraction>=minConvergedFraction && meanChi2>=0.5 && meanChi2<=2.0 && fitsPerSecond>=minFitsPerSecond;
+    printf("%s\n",pass ? "PASSED" : "FAILED");
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,350 @@
+#ifndef _KINEMATICFITTER_H_
+#define _KINEMATICFITTER_H_
+
+#include <cmath>
+#include <algorithm>
+
+/*
+* Constrained kinematic fit of the leptonic top quark decay t -> b l nu.
+*
+* The fit parameters are the lepton pt, the b-jet pt and the neutrino
+* px, py, pz; the directions of lepton and b-jet are kept. Lepton pt, b-jet
+* pt and the MET components are measured with the given resolutions, the
+* neutrino pz is unmeasured. The constraints are
+*
+*   (l+nu)^2   = mW^2
+*   (l+nu+b)^2 = mt^2
+*
+* The chi2 of the measured parameters is minimised subject to the linearised
+* constraints with Lagrange multipliers; each Gauss-Newton iteration solves
+* the 7x7 system
+*
+*   | V^-1  D^T | |delta |   | -V^-1 (p-m) |
+*   | D     0   | |lambda| = | -g          |
+*
+* with the analytic Jacobian D of the constraints. Near the branch point of
+* the two neutrino pz solutions the full step can oscillate, so the step is
+* halved until the L1 merit function chi2/2 + sum mu_c |g_c| decreases. All
+* matrices are fixed size arrays on the stack.
+*/
+class KinematicFitter
+{
+    public:
+    enum
+    {
+        LEPTON_PT=0,
+        BJET_PT=1,
+        NEUTRINO_PX=2,
+        NEUTRINO_PY=3,
+        NEUTRINO_PZ=4,
+        NUM_PARAMETERS=5,
+        NUM_CONSTRAINTS=2,
+        SIZE=NUM_PARAMETERS+NUM_CONSTRAINTS
+    };
+
+    //four-vectors are stored as px, py, pz, E
+    struct Input
+    {
+        //lepton four-vector per unit pt, the lepton is taken massless
+        double leptonDirection[4];
+        //b-jet four-vector per unit pt, scaled as a whole
+        double bjetDirection[4];
+        //measured values and resolutions, the neutrino pz is only the start value
+        double measured[NUM_PARAMETERS];
+        double sigma[NUM_PARAMETERS];
+    };
+
+    struct Result
+    {
+        double parameters[NUM_PARAMETERS];
+        double chi2;
+        int iterations;
+        bool converged;
+    };
+
+    private:
+    double _wMass2;
+    double _topMass2;
+    int _maxIterations;
+    //convergence if all constraints are below this relative to the squared masses
+    double _tolerance;
+
+    static inline double dot(const double* a, const double* b)
+    {
+        return a[3]*b[3] - a[0]*b[0] - a[1]*b[1] - a[2]*b[2];
+    }
+
+    //derivative of a.nu with respect to the neutrino momentum component k
+    static inline double dotDerivative(const double* a, const double* nu, int k)
+    {
+        return a[3]*nu[k]/nu[3] - a[k];
+    }
+
+    //Gaussian elimination with partial pivoting, the solution is left in the last column
+    static bool solveLinear(double (&m)[SIZE][SIZE+1])
+    {
+        for (int col=0; col<SIZE; ++col)
+        {
+            int pivot = col;
+            for (int row=col+1; row<SIZE; ++row)
+            {
+                if (std::fabs(m[row][col])>std::fabs(m[pivot][col]))
+                {
+                    pivot = row;
+                }
+            }
+            if (!(std::fabs(m[pivot][col])>1e-300))
+            {
+                return false;
+            }
+            if (pivot!=col)
+            {
+                for (int k=col; k<=SIZE; ++k)
+                {
+                    const double tmp = m[col][k];
+                    m[col][k] = m[pivot][k];
+                    m[pivot][k] = tmp;
+                }
+            }
+            for (int row=col+1; row<SIZE; ++row)
+            {
+                const double factor = m[row][col]/m[col][col];
+                for (int k=col; k<=SIZE; ++k)
+                {
+                    m[row][k] -= factor*m[col][k];
+                }
+            }
+        }
+        for (int row=SIZE-1; row>=0; --row)
+        {
+            double sum = m[row][SIZE];
+            for (int k=row+1; k<SIZE; ++k)
+            {
+                sum -= m[row][k]*m[k][SIZE];
+            }
+            m[row][SIZE] = sum/m[row][row];
+        }
+        return true;
+    }
+
+    inline void fourVectors(const Input& input, const double* p, double* lepton, double* bjet, double* neutrino) const
+    {
+        for (int k=0; k<4; ++k)
+        {
+            lepton[k] = p[LEPTON_PT]*input.leptonDirection[k];
+            bjet[k] = p[BJET_PT]*input.bjetDirection[k];
+        }
+        neutrino[0] = p[NEUTRINO_PX];
+        neutrino[1] = p[NEUTRINO_PY];
+        neutrino[2] = p[NEUTRINO_PZ];
+        neutrino[3] = std::sqrt(neutrino[0]*neutrino[0] + neutrino[1]*neutrino[1] + neutrino[2]*neutrino[2]);
+    }
+
+    inline void constraints(const Input& input, const double* p, double* g) const
+    {
+        double lepton[4];
+        double bjet[4];
+        double neutrino[4];
+        fourVectors(input,p,lepton,bjet,neutrino);
+        //lepton and neutrino are massless
+        const double leptonNeutrino = 2*dot(lepton,neutrino);
+        g[0] = leptonNeutrino - _wMass2;
+        g[1] = leptonNeutrino + dot(bjet,bjet) + 2*(dot(bjet,lepton)+dot(bjet,neutrino)) - _topMass2;
+    }
+
+    static inline double merit(const Input& input, const double* weight, const double* p, const double* g, const double* mu)
+    {
+        double value = 0;
+        for (int i=0; i<NUM_PARAMETERS; ++i)
+        {
+            value += 0.5*weight[i]*(p[i]-input.measured[i])*(p[i]-input.measured[i]);
+        }
+        for (int c=0; c<NUM_CONSTRAINTS; ++c)
+        {
+            value += mu[c]*std::fabs(g[c]);
+        }
+        return value;
+    }
+
+    public:
+    KinematicFitter(double wMass=80.38, double topMass=172.5, int maxIterations=20, double tolerance=1e-5):
+        _wMass2(wMass*wMass),
+        _topMass2(topMass*topMass),
+        _maxIterations(maxIterations),
+        _tolerance(tolerance)
+    {
+    }
+
+    void setWMass(double wMass)
+    {
+        _wMass2 = wMass*wMass;
+    }
+
+    void setTopMass(double topMass)
+    {
+        _topMass2 = topMass*topMass;
+    }
+
+    void setMaxIterations(int maxIterations)
+    {
+        _maxIterations = maxIterations;
+    }
+
+    void setTolerance(double tolerance)
+    {
+        _tolerance = tolerance;
+    }
+
+    //builds the four-vectors of the fitted parameters, px, py, pz, E each
+    void getFourVectors(const Input& input, const Result& result, double* lepton, double* bjet, double* neutrino) const
+    {
+        fourVectors(input,result.parameters,lepton,bjet,neutrino);
+    }
+
+    bool fit(const Input& input, Result& result) const
+    {
+        double weight[NUM_PARAMETERS];
+        for (int i=0; i<NUM_PARAMETERS; ++i)
+        {
+            weight[i] = i==NEUTRINO_PZ || !(input.sigma[i]>0) ? 0.0 : 1.0/(input.sigma[i]*input.sigma[i]);
+        }
+        double* p = result.parameters;
+        for (int i=0; i<NUM_PARAMETERS; ++i)
+        {
+            p[i] = input.measured[i];
+        }
+        result.converged = false;
+        result.iterations = 0;
+        double mu[NUM_CONSTRAINTS] = {0,0};
+        double lambda[NUM_CONSTRAINTS] = {0,0};
+
+        double lepton[4];
+        double bjet[4];
+        double neutrino[4];
+        for (int iteration=1; iteration<=_maxIterations; ++iteration)
+        {
+            result.iterations = iteration;
+            fourVectors(input,p,lepton,bjet,neutrino);
+            if (!(neutrino[3]>0) || !(p[LEPTON_PT]>0) || !(p[BJET_PT]>0))
+            {
+                return false;
+            }
+            double leptonNeutrino[4];
+            double leptonBJet[4];
+            double neutrinoBJet[4];
+            for (int k=0; k<4; ++k)
+            {
+                leptonNeutrino[k] = lepton[k]+neutrino[k];
+                leptonBJet[k] = lepton[k]+bjet[k];
+                neutrinoBJet[k] = neutrino[k]+bjet[k];
+            }
+
+            double g[NUM_CONSTRAINTS];
+            constraints(input,p,g);
+
+            double D[NUM_CONSTRAINTS][NUM_PARAMETERS];
+            D[0][LEPTON_PT] = 2*dot(input.leptonDirection,neutrino);
+            D[0][BJET_PT] = 0;
+            D[1][LEPTON_PT] = 2*dot(input.leptonDirection,neutrinoBJet);
+            D[1][BJET_PT] = 2*p[BJET_PT]*dot(input.bjetDirection,input.bjetDirection) + 2*dot(input.bjetDirection,leptonNeutrino);
+            for (int k=0; k<3; ++k)
+            {
+                D[0][NEUTRINO_PX+k] = 2*dotDerivative(lepton,neutrino,k);
+                D[1][NEUTRINO_PX+k] = 2*dotDerivative(leptonBJet,neutrino,k);
+            }
+
+            const bool satisfied = std::fabs(g[0])<_tolerance*_wMass2 && std::fabs(g[1])<_tolerance*_topMass2;
+
+            //Hessian of the Lagrangian, the constraint curvature enters with the multipliers of the previous step
+            double H[NUM_PARAMETERS][NUM_PARAMETERS] = {};
+            double leptonBJetSum[4];
+            for (int k=0; k<4; ++k)
+            {
+                leptonBJetSum[k] = lambda[0]*lepton[k] + lambda[1]*leptonBJet[k];
+            }
+            H[LEPTON_PT][BJET_PT] = H[BJET_PT][LEPTON_PT] = 2*lambda[1]*dot(input.leptonDirection,input.bjetDirection);
+            H[BJET_PT][BJET_PT] = 2*lambda[1]*dot(input.bjetDirection,input.bjetDirection);
+            for (int k=0; k<3; ++k)
+            {
+                const double leptonTerm = 2*(lambda[0]+lambda[1])*dotDerivative(input.leptonDirection,neutrino,k);
+                const double bjetTerm = 2*lambda[1]*dotDerivative(input.bjetDirection,neutrino,k);
+                H[LEPTON_PT][NEUTRINO_PX+k] = H[NEUTRINO_PX+k][LEPTON_PT] = leptonTerm;
+                H[BJET_PT][NEUTRINO_PX+k] = H[NEUTRINO_PX+k][BJET_PT] = bjetTerm;
+                for (int j=0; j<3; ++j)
+                {
+                    //second derivative of the neutrino energy
+                    const double d2E = ((k==j ? 1.0 : 0.0) - neutrino[k]*neutrino[j]/(neutrino[3]*neutrino[3]))/neutrino[3];
+                    H[NEUTRINO_PX+k][NEUTRINO_PX+j] = 2*leptonBJetSum[3]*d2E;
+                }
+            }
+
+            double m[SIZE][SIZE+1] = {};
+            for (int i=0; i<NUM_PARAMETERS; ++i)
+            {
+                for (int j=0; j<NUM_PARAMETERS; ++j)
+                {
+                    m[i][j] = H[i][j];
+                }
+                m[i][i] += weight[i];
+                m[i][SIZE] = -weight[i]*(p[i]-input.measured[i]);
+                for (int c=0; c<NUM_CONSTRAINTS; ++c)
+                {
+                    m[i][NUM_PARAMETERS+c] = D[c][i];
+                    m[NUM_PARAMETERS+c][i] = D[c][i];
+                }
+            }
+            for (int c=0; c<NUM_CONSTRAINTS; ++c)
+            {
+                m[NUM_PARAMETERS+c][SIZE] = -g[c];
+            }
+            if (!solveLinear(m))
+            {
+                return false;
+            }
+
+            for (int c=0; c<NUM_CONSTRAINTS; ++c)
+            {
+                lambda[c] = m[NUM_PARAMETERS+c][SIZE];
+                mu[c] = std::max(mu[c],2*std::fabs(lambda[c]));
+            }
+            const double currentMerit = merit(input,weight,p,g,mu);
+            double fraction = 1.0;
+            double trial[NUM_PARAMETERS];
+            for (int halving=0; halving<10; ++halving)
+            {
+                for (int i=0; i<NUM_PARAMETERS; ++i)
+                {
+                    trial[i] = p[i] + fraction*m[i][SIZE];
+                }
+                double trialG[NUM_CONSTRAINTS];
+                constraints(input,trial,trialG);
+                if (merit(input,weight,trial,trialG,mu)<=currentMerit)
+                {
+                    break;
+                }
+                fraction *= 0.5;
+            }
+
+            double step = 0;
+            for (int i=0; i<NUM_PARAMETERS; ++i)
+            {
+                step = std::max(step,std::fabs(trial[i]-p[i])/(input.sigma[i]>0 ? input.sigma[i] : 1.0));
+                p[i] = trial[i];
+            }
+            if (satisfied && step<1e-3)
+            {
+                result.converged = true;
+                break;
+            }
+        }
+
+        result.chi2 = 0;
+        for (int i=0; i<NUM_PARAMETERS; ++i)
+        {
+            result.chi2 += weight[i]*(p[i]-input.measured[i])*(p[i]-input.measured[i]);
+        }
+        return result.converged;
+    }
+};
+
+#endif
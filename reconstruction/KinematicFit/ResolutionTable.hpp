@@ -0,0 +1,138 @@
+#ifndef _RESOLUTIONTABLE_H_
+#define _RESOLUTIONTABLE_H_
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <cmath>
+
+/*
+* Transverse momentum resolutions of the fitted objects, parametrised in
+* bins of |eta| as
+*
+*   sigma(pt) = sqrt(N^2 + S^2 pt + C^2 pt^2)
+*
+* with noise N, stochastic term S and constant term C. The built-in table
+* can be replaced from a text file where each non-empty line describes one
+* bin
+*
+*   <lepton|jet|met> <|eta| min> <|eta| max> <N> <S> <C>
+*
+* and everything after a '#' is ignored. The MET resolution is used for
+* each of its components and evaluated at the MET, its |eta| range is
+* irrelevant. Values beyond the last bin use the last bin.
+*/
+class ResolutionTable
+{
+    public:
+    enum Object
+    {
+        LEPTON=0,
+        JET=1,
+        MET=2,
+        NUM_OBJECTS=3
+    };
+
+    private:
+    struct Bin
+    {
+        double etaMin;
+        double etaMax;
+        double noise2;
+        double stochastic2;
+        double constant2;
+    };
+
+    std::vector<Bin> _bins[NUM_OBJECTS];
+
+    void addBin(Object object, double etaMin, double etaMax, double noise, double stochastic, double constant) throw (std::runtime_error)
+    {
+        std::vector<Bin>& bins = _bins[object];
+        if (etaMin>=etaMax || (bins.empty() ? etaMin!=0.0 : etaMin!=bins.back().etaMax))
+        {
+            throw std::runtime_error("resolution bins need to be contiguous in |eta| starting at 0");
+        }
+        Bin bin = {etaMin,etaMax,noise*noise,stochastic*stochastic,constant*constant};
+        bins.push_back(bin);
+    }
+
+    public:
+    ResolutionTable()
+    {
+        addBin(LEPTON,0.0,1.5,0.0,0.0,0.015);
+        addBin(LEPTON,1.5,5.0,0.0,0.0,0.03);
+        addBin(JET,0.0,1.5,5.6,1.25,0.033);
+        addBin(JET,1.5,5.0,4.8,1.5,0.05);
+        addBin(MET,0.0,5.0,15.0,0.0,0.05);
+    }
+
+    void load(const std::string& fileName) throw (std::runtime_error)
+    {
+        std::ifstream ifs(fileName.c_str());
+        if (!ifs.is_open())
+        {
+            throw std::runtime_error("cannot open resolution file '"+fileName+"'");
+        }
+        for (unsigned iobject=0; iobject<NUM_OBJECTS; ++iobject)
+        {
+            _bins[iobject].clear();
+        }
+        std::string line;
+        unsigned lineNumber = 0;
+        while (std::getline(ifs,line))
+        {
+            ++lineNumber;
+            std::istringstream stream(line.substr(0,line.find('#')));
+            std::string objectName;
+            if (!(stream>>objectName))
+            {
+                continue;
+            }
+            double etaMin, etaMax, noise, stochastic, constant;
+            std::string rest;
+            if (!(stream>>etaMin>>etaMax>>noise>>stochastic>>constant) || (stream>>rest))
+            {
+                std::ostringstream message;
+                message<<"resolution file '"<<fileName<<"' line "<<lineNumber<<": expected '<lepton|jet|met> <|eta| min> <|eta| max> <N> <S> <C>'";
+                throw std::runtime_error(message.str());
+            }
+            Object object;
+            if (objectName=="lepton")
+            {
+                object = LEPTON;
+            } else if (objectName=="jet") {
+                object = JET;
+            } else if (objectName=="met") {
+                object = MET;
+            } else {
+                std::ostringstream message;
+                message<<"resolution file '"<<fileName<<"' line "<<lineNumber<<": unknown object '"<<objectName<<"'";
+                throw std::runtime_error(message.str());
+            }
+            addBin(object,etaMin,etaMax,noise,stochastic,constant);
+        }
+        for (unsigned iobject=0; iobject<NUM_OBJECTS; ++iobject)
+        {
+            if (_bins[iobject].empty())
+            {
+                throw std::runtime_error("resolution file '"+fileName+"' needs bins for lepton, jet and met");
+            }
+        }
+    }
+
+    inline double getResolution(Object object, double pt, double absEta) const
+    {
+        const std::vector<Bin>& bins = _bins[object];
+        unsigned ibin = 0;
+        for (unsigned i=0; i+1<bins.size(); ++i)
+        {
+            ibin += absEta>=bins[i].etaMax;
+        }
+        const Bin& bin = bins[ibin];
+        return std::sqrt(bin.noise2 + bin.stochastic2*pt + bin.constant2*pt*pt);
+    }
+};
+
+#endif
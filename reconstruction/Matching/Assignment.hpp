@@ -0,0 +1,144 @@
+#ifndef _ASSIGNMENT_H_
+#define _ASSIGNMENT_H_
+
+#include <vector>
+#include <limits>
+
+/*
+* Minimum cost assignment of the rows of a cost matrix to distinct columns
+* (Hungarian method with shortest augmenting paths as formulated by Jonker
+* and Volgenant). The matrix has at most as many rows as columns, each row
+* is assigned to exactly one column and the sum of the costs is minimal.
+* The rows are added one after another, each by a Dijkstra-like search over
+* the reduced costs, giving O(rows^2 columns) operations in total.
+*
+* Pairs which must not be assigned get the cost FORBIDDEN. It is finite to
+* keep the arithmetic on the potentials exact enough but larger than any
+* sum of allowed costs, so a forbidden pair is only chosen if the row
+* cannot be assigned otherwise; the caller has to treat such a pair as
+* unassigned. The buffers are kept between the calls.
+*/
+class Assignment
+{
+    public:
+    static constexpr double FORBIDDEN = 1e9;
+
+    private:
+    unsigned _rows;
+    unsigned _columns;
+    std::vector<double> _cost;
+
+    //potentials and the search state, column 0 is the virtual start of a path
+    std::vector<double> _rowPotential;
+    std::vector<double> _columnPotential;
+    std::vector<unsigned> _rowOfColumn;
+    std::vector<unsigned> _previousColumn;
+    std::vector<double> _minReducedCost;
+    std::vector<char> _visited;
+    std::vector<int> _columnOfRow;
+
+    public:
+    Assignment() :
+        _rows(0),
+        _columns(0)
+    {
+    }
+
+    //the costs are undefined after a resize
+    void resize(unsigned rows, unsigned columns)
+    {
+        _rows = rows;
+        _columns = columns;
+        _cost.resize(rows*columns);
+    }
+
+    inline double& cost(unsigned row, unsigned column)
+    {
+        return _cost[row*_columns+column];
+    }
+
+    void solve()
+    {
+        const double infinity = std::numeric_limits<double>::infinity();
+        _rowPotential.assign(_rows+1,0.0);
+        _columnPotential.assign(_columns+1,0.0);
+        _rowOfColumn.assign(_columns+1,0);
+        _previousColumn.assign(_columns+1,0);
+        _columnOfRow.assign(_rows,-1);
+        if (_rows>_columns)
+        {
+            return;
+        }
+        //rows and columns are counted from 1 in the search
+        for (unsigned row=1; row<=_rows; ++row)
+        {
+            _rowOfColumn[0] = row;
+            unsigned column = 0;
+            _minReducedCost.assign(_columns+1,infinity);
+            _visited.assign(_columns+1,0);
+            do
+            {
+                _visited[column] = 1;
+                const unsigned currentRow = _rowOfColumn[column];
+                const double* costRow = &_cost[(currentRow-1)*_columns];
+                double delta = infinity;
+                unsigned nextColumn = 0;
+                for (unsigned j=1; j<=_columns; ++j)
+                {
+                    if (_visited[j])
+                    {
+                        continue;
+                    }
+                    const double reducedCost = costRow[j-1] - _rowPotential[currentRow] - _columnPotential[j];
+                    if (reducedCost<_minReducedCost[j])
+                    {
+                        _minReducedCost[j] = reducedCost;
+                        _previousColumn[j] = column;
+                    }
+                    if (_minReducedCost[j]<delta)
+                    {
+                        delta = _minReducedCost[j];
+                        nextColumn = j;
+                    }
+                }
+                for (unsigned j=0; j<=_columns; ++j)
+                {
+                    if (_visited[j])
+                    {
+                        _rowPotential[_rowOfColumn[j]] += delta;
+                        _columnPotential[j] -= delta;
+                    }
+                    else
+                    {
+                        _minReducedCost[j] -= delta;
+                    }
+                }
+                column = nextColumn;
+            }
+            while (_rowOfColumn[column]!=0);
+            //flip the augmenting path
+            do
+            {
+                const unsigned previous = _previousColumn[column];
+                _rowOfColumn[column] = _rowOfColumn[previous];
+                column = previous;
+            }
+            while (column!=0);
+        }
+        for (unsigned j=1; j<=_columns; ++j)
+        {
+            if (_rowOfColumn[j]!=0)
+            {
+                _columnOfRow[_rowOfColumn[j]-1] = j-1;
+            }
+        }
+    }
+
+    //column assigned to the row by the last solve()
+    inline int getColumn(unsigned row) const
+    {
+        return _columnOfRow[row];
+    }
+};
+
+#endif
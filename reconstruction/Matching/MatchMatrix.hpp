@@ -0,0 +1,134 @@
+#ifndef _MATCHMATRIX_H_
+#define _MATCHMATRIX_H_
+
+#include <vector>
+#include <cmath>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+/*
+* Match values of all pairs of a generator and a reconstructed collection
+*
+*   value = deltaR + w |pt(reco)-pt(gen)|/pt(gen)
+*
+* with an optional weight w of the relative pt difference. The eta, phi
+* and pt of each particle are taken once into separate arrays, so the
+* pseudorapidity and the azimuth are not recalculated for every pair, and
+* the matrix is filled row by row without branches. The difference in phi
+* is wrapped into [0,pi] by a select instead of a loop, which holds since
+* the azimuths are within [-pi,pi]. With AVX2 four pairs are processed per
+* instruction, otherwise the loop is left to the compiler to vectorise.
+*
+* The matrix is filled once per collection and serves the assignment, the
+* max match value cut and the stored match values alike.
+*/
+class MatchMatrix
+{
+    private:
+    std::vector<double> _genEta;
+    std::vector<double> _genPhi;
+    std::vector<double> _genPt;
+    std::vector<double> _recoEta;
+    std::vector<double> _recoPhi;
+    std::vector<double> _recoPt;
+
+    //gen x reco, row major
+    std::vector<double> _values;
+    double _relativePtWeight;
+
+    inline void fillRowScalar(unsigned igen, unsigned begin)
+    {
+        const double eta = _genEta[igen];
+        const double phi = _genPhi[igen];
+        const double pt = _genPt[igen];
+        const double ptWeight = _relativePtWeight>0 ? _relativePtWeight/pt : 0;
+        const unsigned numReco = _recoEta.size();
+        double* row = &_values[igen*numReco];
+        for (unsigned ireco=begin; ireco<numReco; ++ireco)
+        {
+            const double deltaEta = _recoEta[ireco]-eta;
+            const double absDeltaPhi = std::fabs(_recoPhi[ireco]-phi);
+            const double deltaPhi = absDeltaPhi>M_PI ? 2*M_PI-absDeltaPhi : absDeltaPhi;
+            row[ireco] = std::sqrt(deltaEta*deltaEta + deltaPhi*deltaPhi) + ptWeight*std::fabs(_recoPt[ireco]-pt);
+        }
+    }
+
+#ifdef __AVX2__
+    inline unsigned fillRowAVX2(unsigned igen)
+    {
+        const __m256d signMask = _mm256_set1_pd(-0.0);
+        const __m256d pi = _mm256_set1_pd(M_PI);
+        const __m256d twoPi = _mm256_set1_pd(2*M_PI);
+        const __m256d eta = _mm256_set1_pd(_genEta[igen]);
+        const __m256d phi = _mm256_set1_pd(_genPhi[igen]);
+        const __m256d pt = _mm256_set1_pd(_genPt[igen]);
+        const __m256d ptWeight = _mm256_set1_pd(_relativePtWeight>0 ? _relativePtWeight/_genPt[igen] : 0);
+        const unsigned numReco = _recoEta.size();
+        double* row = &_values[igen*numReco];
+        unsigned ireco = 0;
+        for (; ireco+4<=numReco; ireco+=4)
+        {
+            const __m256d deltaEta = _mm256_sub_pd(_mm256_loadu_pd(&_recoEta[ireco]),eta);
+            const __m256d absDeltaPhi = _mm256_andnot_pd(signMask,_mm256_sub_pd(_mm256_loadu_pd(&_recoPhi[ireco]),phi));
+            const __m256d wrap = _mm256_cmp_pd(absDeltaPhi,pi,_CMP_GT_OQ);
+            const __m256d deltaPhi = _mm256_blendv_pd(absDeltaPhi,_mm256_sub_pd(twoPi,absDeltaPhi),wrap);
+            const __m256d deltaR = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(deltaEta,deltaEta),_mm256_mul_pd(deltaPhi,deltaPhi)));
+            const __m256d deltaPt = _mm256_andnot_pd(signMask,_mm256_sub_pd(_mm256_loadu_pd(&_recoPt[ireco]),pt));
+            _mm256_storeu_pd(&row[ireco],_mm256_add_pd(deltaR,_mm256_mul_pd(ptWeight,deltaPt)));
+        }
+        return ireco;
+    }
+#endif
+
+    public:
+    MatchMatrix() :
+        _relativePtWeight(0)
+    {
+    }
+
+    void setRelativePtWeight(double relativePtWeight)
+    {
+        _relativePtWeight = relativePtWeight;
+    }
+
+    template <class Particle>
+    void fill(const std::vector<Particle*>& gen, const std::vector<Particle*>& reco)
+    {
+        _genEta.resize(gen.size());
+        _genPhi.resize(gen.size());
+        _genPt.resize(gen.size());
+        for (unsigned igen=0; igen<gen.size(); ++igen)
+        {
+            _genEta[igen] = gen[igen]->getEta();
+            _genPhi[igen] = gen[igen]->getPhi();
+            _genPt[igen] = gen[igen]->getPt();
+        }
+        _recoEta.resize(reco.size());
+        _recoPhi.resize(reco.size());
+        _recoPt.resize(reco.size());
+        for (unsigned ireco=0; ireco<reco.size(); ++ireco)
+        {
+            _recoEta[ireco] = reco[ireco]->getEta();
+            _recoPhi[ireco] = reco[ireco]->getPhi();
+            _recoPt[ireco] = reco[ireco]->getPt();
+        }
+        _values.resize(gen.size()*reco.size());
+        for (unsigned igen=0; igen<gen.size(); ++igen)
+        {
+            unsigned begin = 0;
+#ifdef __AVX2__
+            begin = fillRowAVX2(igen);
+#endif
+            fillRowScalar(igen,begin);
+        }
+    }
+
+    inline double get(unsigned igen, unsigned ireco) const
+    {
+        return _values[igen*_recoEta.size()+ireco];
+    }
+};
+
+#endif
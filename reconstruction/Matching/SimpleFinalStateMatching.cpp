@@ -5,6 +5,9 @@
 #include "pxl/modules/Module.hh"
 #include "pxl/modules/ModuleFactory.hh"
 
+#include "Assignment.hpp"
+#include "MatchMatrix.hpp"
+
 #include <algorithm>
 
 static pxl::Logger logger("SimpleFinalStateMatching");
@@ -35,7 +38,14 @@ class SimpleFinalStateMatching : public pxl::Module
     bool _copyOnlyFinalParticles;
     
     double _maxMatchValue;
+    double _relativePtWeight;
 
+    MatchMatrix _matchMatrix;
+    Assignment _assignment;
+    std::vector<pxl::Particle*> _bestMatch;
+    std::vector<char> _assigned;
+    //match values of the pairs after match()
+    std::vector<double> _matchValues;
 
     public:
     SimpleFinalStateMatching():
@@ -50,7 +60,8 @@ class SimpleFinalStateMatching : public pxl::Module
         _inputRecoBJetName("SelectedBJet"),
         _discardBTagging(false),
         _copyOnlyFinalParticles(true),
-        _maxMatchValue(10)
+        _maxMatchValue(10),
+        _relativePtWeight(0)
     {
         _input = addSink("input", "input");
         _output = addSource("output", "output");
@@ -63,6 +74,7 @@ class SimpleFinalStateMatching : public pxl::Module
         addOption("copy only final","copies only the final state generator particles",_copyOnlyFinalParticles);
         
         addOption("max match value","matches beyond that value are considered as missing",_maxMatchValue);
+        addOption("relative pt weight","weight of |pt(reco)-pt(gen)|/pt(gen) added to deltaR in the match value",_relativePtWeight);
 
         addOption("reco met","name of the reconstructed met",_inputRecoMETName);
         addOption("reco electon","names of the reconstructed electon",_inputRecoElectronName);
@@ -110,6 +122,8 @@ class SimpleFinalStateMatching : public pxl::Module
         getOption("copy only final",_copyOnlyFinalParticles);
         
         getOption("max match value",_maxMatchValue);
+        getOption("relative pt weight",_relativePtWeight);
+        _matchMatrix.setRelativePtWeight(_relativePtWeight);
 
         getOption("reco met",_inputRecoMETName);
         getOption("reco electon",_inputRecoElectronName);
@@ -137,10 +151,11 @@ class SimpleFinalStateMatching : public pxl::Module
         return particle->getDaughterRelations().size()==0;
     }
 
-    void addMatchToView(std::vector<pxl::Particle*>& gen, std::vector<pxl::Particle*>& reco,pxl::EventView* eventView, float(*matchFunction)(const pxl::Particle*, const pxl::Particle*))
+    void addMatchToView(std::vector<pxl::Particle*>& gen, std::vector<pxl::Particle*>& reco,pxl::EventView* eventView)
     {
         for (unsigned iparticle=0; iparticle<std::max(gen.size(),reco.size()); ++iparticle)
         {
+            const bool matched = iparticle<gen.size() && iparticle<reco.size() && _matchValues[iparticle]<_maxMatchValue;
             pxl::Particle* genMatch=0;
             if (iparticle<gen.size())
             {
@@ -159,7 +174,7 @@ class SimpleFinalStateMatching : public pxl::Module
                 genMatch->setP4(0.0,0.0,0.0,0.0);
             }
             pxl::Particle* recoMatch = eventView->create<pxl::Particle>();
-            if (iparticle<reco.size() && deltaRmatch(genMatch,reco[iparticle])<_maxMatchValue)
+            if (matched)
             {
                 recoMatch->setName(reco[iparticle]->getName());
                 copyParticleProperties(recoMatch,reco[iparticle]);
@@ -187,9 +202,9 @@ class SimpleFinalStateMatching : public pxl::Module
 
             }
             recoMatch->linkMother(genMatch);
-            if (iparticle<gen.size() && iparticle<reco.size() && deltaRmatch(genMatch,reco[iparticle])<_maxMatchValue)
+            if (matched)
             {
-                genMatch->setUserRecord("match_value",deltaRmatch(genMatch,recoMatch));
+                genMatch->setUserRecord("match_value",float(_matchValues[iparticle]));
             }
             else
             {
@@ -199,70 +214,51 @@ class SimpleFinalStateMatching : public pxl::Module
         }
     }
 
-    static float deltaRmatch(const pxl::Particle* p1, const pxl::Particle* p2)
-    {
-        return p1->getVector().deltaR(p2->getVector());
-    }
-
-    void match(std::vector<pxl::Particle*>& gen, std::vector<pxl::Particle*>& reco, float(*matchFunction)(const pxl::Particle*, const pxl::Particle*))
+    /*
+    * Reorders the larger of the two collections such that its first elements
+    * are the matches of the elements of the smaller one with the minimal sum
+    * of the match values. Pairs beyond the max match value are never preferred
+    * over allowed ones. The remaining elements follow ordered by pt. The
+    * match values of the pairs are kept for addMatchToView.
+    */
+    void match(std::vector<pxl::Particle*>& gen, std::vector<pxl::Particle*>& reco)
     {
-        std::vector<pxl::Particle*> bestMatch;
-        int permutation=0;
-        if (gen.size()<=reco.size())
+        const bool reorderReco = gen.size()<=reco.size();
+        std::vector<pxl::Particle*>& fixed = reorderReco ? gen : reco;
+        std::vector<pxl::Particle*>& reordered = reorderReco ? reco : gen;
+        std::sort(reordered.begin(),reordered.end(),compare);
+        _matchMatrix.fill(gen,reco);
+
+        _assignment.resize(fixed.size(),reordered.size());
+        for (unsigned ifixed=0; ifixed<fixed.size(); ++ifixed)
         {
-            std::sort(reco.begin(),reco.end(),compare);
-            float minMatchValue=1000.0;
-            do {
-                float matchValue=0.0;
-                for (unsigned igen=0; igen<gen.size(); ++igen)
-                {
-                    matchValue+=matchFunction(gen[igen],reco[igen]);
-                }
-                if (minMatchValue>matchValue)
-                {
-                    minMatchValue=matchValue;
-                    bestMatch=std::vector<pxl::Particle*>();
-                    for (unsigned ireco=0; ireco<reco.size(); ++ireco)
-                    {
-                        bestMatch.push_back(reco[ireco]);
-                    }
-
-                }
-                ++permutation;
-            } while ( std::next_permutation(reco.begin(),reco.end(),compare));
-            for (unsigned ireco=0; ireco<reco.size(); ++ireco)
+            for (unsigned ireordered=0; ireordered<reordered.size(); ++ireordered)
             {
-                reco[ireco]=bestMatch[ireco];
+                const double matchValue = reorderReco ? _matchMatrix.get(ifixed,ireordered) : _matchMatrix.get(ireordered,ifixed);
+                _assignment.cost(ifixed,ireordered) = matchValue<_maxMatchValue ? matchValue : Assignment::FORBIDDEN;
             }
         }
-        else
-        {
-            std::sort(gen.begin(),gen.end(),compare);
-            float minMatchValue=1000.0;
-            do {
-                float matchValue=0.0;
-                for (unsigned ireco=0; ireco<reco.size(); ++ireco)
-                {
-                    matchValue+=matchFunction(gen[ireco],reco[ireco]);
-                }
-                if (minMatchValue>matchValue)
-                {
-                    minMatchValue=matchValue;
-                    bestMatch=std::vector<pxl::Particle*>();
-                    for (unsigned igen=0; igen<gen.size(); ++igen)
-                    {
-                        bestMatch.push_back(gen[igen]);
-                    }
+        _assignment.solve();
 
-                }
-                ++permutation;
-            } while ( std::next_permutation(gen.begin(),gen.end(),compare));\
-            for (unsigned igen=0; igen<gen.size(); ++igen)
+        _bestMatch.clear();
+        _matchValues.clear();
+        _assigned.assign(reordered.size(),0);
+        for (unsigned ifixed=0; ifixed<fixed.size(); ++ifixed)
+        {
+            const int ireordered = _assignment.getColumn(ifixed);
+            _bestMatch.push_back(reordered[ireordered]);
+            _matchValues.push_back(reorderReco ? _matchMatrix.get(ifixed,ireordered) : _matchMatrix.get(ireordered,ifixed));
+            _assigned[ireordered] = 1;
+        }
+        for (unsigned ireordered=0; ireordered<reordered.size(); ++ireordered)
+        {
+            if (!_assigned[ireordered])
             {
-                gen[igen]=bestMatch[igen];
+                _bestMatch.push_back(reordered[ireordered]);
             }
         }
-        logger(pxl::LOG_LEVEL_DEBUG,"elements: ",std::max(gen.size(),reco.size()),"permutations: ",permutation);
+        reordered.swap(_bestMatch);
+        logger(pxl::LOG_LEVEL_DEBUG,"elements: ",reordered.size(),"assigned: ",fixed.size());
     }
 
     bool analyse(pxl::Sink *sink) throw (std::runtime_error)
@@ -391,16 +387,14 @@ class SimpleFinalStateMatching : public pxl::Module
                 }
                 
 
-                float (*matchFunction)(const pxl::Particle*, const pxl::Particle*) = &SimpleFinalStateMatching::deltaRmatch;
-
-                match(genMuons,recoMuons,matchFunction);
-                addMatchToView(genMuons,recoMuons,outputEventView,matchFunction);
-                match(genElectrons,recoElectrons,matchFunction);
-                addMatchToView(genElectrons,recoElectrons,outputEventView,matchFunction);
-                match(genQuarks,recoJets,matchFunction);
-                addMatchToView(genQuarks,recoJets,outputEventView,matchFunction);
-                match(genBQuarks,recoBJets,matchFunction);
-                addMatchToView(genBQuarks,recoBJets,outputEventView,matchFunction);
+                match(genMuons,recoMuons);
+                addMatchToView(genMuons,recoMuons,outputEventView);
+                match(genElectrons,recoElectrons);
+                addMatchToView(genElectrons,recoElectrons,outputEventView);
+                match(genQuarks,recoJets);
+                addMatchToView(genQuarks,recoJets,outputEventView);
+                match(genBQuarks,recoBJets);
+                addMatchToView(genBQuarks,recoBJets,outputEventView);
 
                 outputEventView->insertObject(genMET);
                 outputEventView->insertObject(recoMET);
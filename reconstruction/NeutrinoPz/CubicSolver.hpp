@@ -0,0 +1,86 @@
+#ifndef _CUBICSOLVER_H_
+#define _CUBICSOLVER_H_
+
+#include <cmath>
+
+/*
+* Real roots of a*x^3 + b*x^2 + c*x + d = 0 in double precision.
+*
+* For a non-positive discriminant the three real roots are taken from the
+* trigonometric form, otherwise the single real root from Cardano's formula
+* where the cube root is taken of the term without cancellation. Each root
+* is refined by one Newton step which is only kept if it lowers the
+* residual.
+*
+* Like the former complex-valued solution a root is reported if its
+* imaginary part is below IMAGINARY_TOLERANCE, i.e. nearly degenerate
+* complex pairs are returned as a double real root. Returns the number of
+* roots written to 'roots' (0, 1 or 3); a vanishing 'a' yields no roots.
+*/
+class CubicSolver
+{
+    public:
+    static constexpr double IMAGINARY_TOLERANCE = 0.0001;
+
+    static inline unsigned solve(double a, double b, double c, double d, double* roots)
+    {
+        if (a==0)
+        {
+            return 0;
+        }
+        const double sqrt3 = 1.7320508075688772;
+        const double q = (3*a*c-b*b)/(9*a*a);
+        const double r = (9*a*b*c - 27*a*a*d - 2*b*b*b)/(54*a*a*a);
+        const double delta = q*q*q + r*r;
+        const double shift = -b/(3*a);
+
+        unsigned numRoots = 0;
+        if (delta<=0)
+        {
+            const double sqrtMinusQ = std::sqrt(-q);
+            const double rho = sqrtMinusQ*sqrtMinusQ*sqrtMinusQ;
+            double cosTheta = rho>0 ? r/rho : 0;
+            cosTheta = cosTheta>1 ? 1 : (cosTheta<-1 ? -1 : cosTheta);
+            const double theta = std::acos(cosTheta)/3;
+            const double real = sqrtMinusQ*std::cos(theta);
+            const double imag = sqrtMinusQ*std::sin(theta);
+            roots[numRoots++] = 2*real + shift;
+            roots[numRoots++] = -real - sqrt3*imag + shift;
+            roots[numRoots++] = -real + sqrt3*imag + shift;
+        }
+        else
+        {
+            //s*t = -q, take the cube root without cancellation and derive the other
+            const double u = std::cbrt(r + std::copysign(std::sqrt(delta),r));
+            const double v = u!=0 ? -q/u : 0;
+            roots[numRoots++] = u + v + shift;
+            if (std::fabs(u-v)*sqrt3/2<IMAGINARY_TOLERANCE)
+            {
+                roots[numRoots++] = -(u+v)/2 + shift;
+                roots[numRoots++] = -(u+v)/2 + shift;
+            }
+        }
+
+        for (unsigned i=0; i<numRoots; ++i)
+        {
+            roots[i] = polish(a,b,c,d,roots[i]);
+        }
+        return numRoots;
+    }
+
+    private:
+    static inline double polish(double a, double b, double c, double d, double x)
+    {
+        const double f = ((a*x + b)*x + c)*x + d;
+        const double df = (3*a*x + 2*b)*x + c;
+        if (df==0)
+        {
+            return x;
+        }
+        const double polished = x - f/df;
+        const double polishedF = ((a*polished + b)*polished + c)*polished + d;
+        return std::fabs(polishedF)<std::fabs(f) ? polished : x;
+    }
+};
+
+#endif
@@ -0,0 +1,175 @@
+/*
+* Accuracy regression of the CubicSolver against the former long double
+* std::complex solution of NeutrinoPz. The cubic equations are built from
+* random lepton and MET kinematics in the same way as in the complex branch
+* of the neutrino solution. Reports the number of equations with a
+* different number of roots and the largest deviation of the roots. Close
+* to degenerate roots the legacy solution itself is inaccurate, so a root
+* deviating by more than the tolerance only fails the check if its
+* residual is also larger than the one of the legacy root and than the
+* rounding error of evaluating the cubic in double precision.
+*
+* usage: CubicSolverAccuracy [number of events] [seed]
+*/
+
+#include "CubicSolver.hpp"
+
+#include <complex>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cfloat>
+#include <algorithm>
+
+//copy of NeutrinoPz::EquationSolve before the switch to the CubicSolver
+template <class T>
+std::vector< T > const legacyEquationSolve(const T & a, const T & b,const T & c,const T & d)
+{
+  std::vector<T> result;
+
+
+  std::complex<T> x1;
+  std::complex<T> x2;
+  std::complex<T> x3;
+
+  if (a != 0) {
+
+    T q = (3*a*c-b*b)/(9*a*a);
+    T r = (9*a*b*c - 27*a*a*d - 2*b*b*b)/(54*a*a*a);
+    T Delta = q*q*q + r*r;
+
+    std::complex<T> s;
+    std::complex<T> t;
+
+    T rho=0;
+    T theta=0;
+
+    if( Delta<=0){
+      rho = sqrt(-(q*q*q));
+
+      theta = acos(r/rho);
+
+      s = std::polar<T>(sqrt(-q),theta/3.0);
+      t = std::polar<T>(sqrt(-q),-theta/3.0);
+    }
+
+    if(Delta>0){
+      s = std::complex<T>(cbrt(r+sqrt(Delta)),0);
+      t = std::complex<T>(cbrt(r-sqrt(Delta)),0);
+    }
+
+    std::complex<T> i(0,1.0);
+
+
+     x1 = s+t+std::complex<T>(-b/(3.0*a),0);
+     x2 = (s+t)*std::complex<T>(-0.5,0)-std::complex<T>(b/(3.0*a),0)+(s-t)*i*std::complex<T>(sqrt(3)/2.0,0);
+     x3 = (s+t)*std::complex<T>(-0.5,0)-std::complex<T>(b/(3.0*a),0)-(s-t)*i*std::complex<T>(sqrt(3)/2.0,0);
+
+    if(fabs(x1.imag())<0.0001)result.push_back(x1.real());
+    if(fabs(x2.imag())<0.0001)result.push_back(x2.real());
+    if(fabs(x3.imag())<0.0001)result.push_back(x3.real());
+
+    return result;
+  }
+  else{return result;}
+
+
+  return result;
+}
+
+int main(int argc, char** argv)
+{
+    const long numEvents = argc>1 ? atol(argv[1]) : 1000000;
+    const unsigned seed = argc>2 ? atoi(argv[2]) : 12345;
+    //largest accepted root deviation relative to max(1,|root|)
+    const double tolerance = 1e-6;
+    const double mW = 80.38;
+
+    std::mt19937_64 generator(seed);
+    std::normal_distribution<double> momentum(0.0,40.0);
+
+    long numEquations = 0;
+    long numRoots = 0;
+    long numCountMismatches = 0;
+    long numDeviations = 0;
+    long numWorse = 0;
+    double maxDeviation = 0;
+    double maxResidual = 0;
+    double maxLegacyResidual = 0;
+
+    for (long ievent=0; ievent<numEvents; ++ievent)
+    {
+        const double pxlep = momentum(generator);
+        const double pylep = momentum(generator);
+        const double pzlep = 3*momentum(generator);
+        const double elep = std::sqrt(pxlep*pxlep+pylep*pylep+pzlep*pzlep);
+        const float metpx = momentum(generator);
+        const float metpy = momentum(generator);
+
+        //only events with complex solutions reach the cubic
+        const double MisET2 = (metpx*metpx + metpy*metpy);
+        const double mu = (mW*mW)/2 + metpx*pxlep + metpy*pylep;
+        const double a = (mu*pzlep)/(elep*elep - pzlep*pzlep);
+        const double b = (elep*elep*MisET2 - mu*mu)/(elep*elep - pzlep*pzlep);
+        if (!(a*a-b<0))
+        {
+            continue;
+        }
+
+        const double ptlep = std::sqrt(pxlep*pxlep+pylep*pylep);
+        const double EquationA = 1;
+        const double EquationB = -3*pylep*mW/(ptlep);
+        const double EquationC = mW*mW*(2*pylep*pylep)/(ptlep*ptlep)+mW*mW-4*pxlep*pxlep*pxlep*metpx/(ptlep*ptlep)-4*pxlep*pxlep*pylep*metpy/(ptlep*ptlep);
+        const double EquationD = 4*pxlep*pxlep*mW*metpy/(ptlep)-pylep*mW*mW*mW/ptlep;
+
+        for (int sign=-1; sign<=1; sign+=2)
+        {
+            ++numEquations;
+            std::vector<long double> legacy = legacyEquationSolve<long double>((long double)EquationA,sign*(long double)EquationB,(long double)EquationC,sign*(long double)EquationD);
+            double roots[3];
+            const unsigned n = CubicSolver::solve(EquationA,sign*EquationB,EquationC,sign*EquationD,roots);
+            if (n!=legacy.size())
+            {
+                ++numCountMismatches;
+                continue;
+            }
+            for (unsigned i=0; i<n; ++i)
+            {
+                ++numRoots;
+                const double x = roots[i];
+                const long double y = legacy[i];
+                const double scale = std::max(1.0,std::fabs(x));
+                const double deviation = double(std::fabs(x-y))/scale;
+                maxDeviation = std::max(maxDeviation,deviation);
+                const double residual = std::fabs(((EquationA*x + sign*EquationB)*x + EquationC)*x + sign*EquationD);
+                const long double legacyResidual = fabsl(((EquationA*y + sign*EquationB)*y + EquationC)*y + sign*EquationD);
+                const double ax = std::fabs(x);
+                const double roundoff = 4*DBL_EPSILON*(((std::fabs(EquationA)*ax + std::fabs(EquationB))*ax + std::fabs(EquationC))*ax + std::fabs(EquationD));
+                if (deviation>tolerance)
+                {
+                    ++numDeviations;
+                    if (residual>legacyResidual && residual>roundoff)
+                    {
+                        ++numWorse;
+                    }
+                }
+                maxResidual = std::max(maxResidual,residual/(scale*scale*scale));
+                maxLegacyResidual = std::max(maxLegacyResidual,double(legacyResidual)/(scale*scale*scale));
+            }
+        }
+    }
+
+    printf("equations:                %li\n",numEquations);
+    printf("compared roots:           %li\n",numRoots);
+    printf("root count mismatches:    %li\n",numCountMismatches);
+    printf("max relative deviation:   %g\n",maxDeviation);
+    printf("roots above tolerance:    %li (less accurate than legacy: %li)\n",numDeviations,numWorse);
+    printf("max scaled residual:      %g (legacy %g)\n",maxResidual,maxLegacyResidual);
+
+    //the imaginary part tolerance may classify borderline equations differently
+    const bool pass = numWorse==0 && numCountMismatches*1e4<=numEquations;
+    printf("%s\n",pass ? "PASSED" : "FAILED");
+    return pass ? 0 : 1;
+}
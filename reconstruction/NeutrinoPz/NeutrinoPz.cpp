@@ -5,8 +5,11 @@
 #include "pxl/modules/Module.hh"
 #include "pxl/modules/ModuleFactory.hh"
 
-#include <complex>
+#include "EventViewIndex.hpp"
+#include "NeutrinoSolver.hpp"
+
 #include <cmath>
+#include <cstdlib>
 
 static pxl::Logger logger("NeutrinoPz");
 
@@ -16,10 +19,34 @@ class NeutrinoPz : public pxl::Module
     pxl::Source* _output;
 
     std::string _inputEventViewName;
+    EventViewIndex _eventViewIndex;
     std::string _metName;
     std::string _leptonName;
     std::string _neutrinoName;
-    
+
+    //candidates of the current event, solved together
+    NeutrinoQuadraticBatch _batch;
+    std::vector<pxl::Particle*> _batchNeutrinos;
+    std::vector<pxl::Particle*> _batchLeptons;
+    std::vector<pxl::Particle*> _batchMETs;
+    std::vector<pxl::Particle*> _viewLeptons;
+
+    bool _allLeptons;
+    std::string _wMassList;
+    std::vector<double> _wMasses;
+    //several neutrinos per event view are linked to their lepton and hypothesis
+    bool _linkCandidates;
+
+    std::string _realSolution;
+    std::string _complexSolution;
+    std::string _metVariations;
+    bool _allStrategies;
+
+    //solver instances of the selected strategies, chosen in beginJob
+    typedef void (NeutrinoQuadraticBatch::*QuadraticSolver)();
+    typedef bool (*ComplexSolver)(pxl::LorentzVector&, const pxl::LorentzVector&, const float&, const float&, double, double);
+    QuadraticSolver _solveQuadratic;
+    ComplexSolver _solveComplex;
 
     public:
     NeutrinoPz() :
@@ -27,8 +54,16 @@ class NeutrinoPz : public pxl::Module
         _inputEventViewName("Reconstructed"),
         _metName("MET"),
         _leptonName("TightMuon"),
-        _neutrinoName("Neutrino")
-
+        _neutrinoName("Neutrino"),
+        _allLeptons(false),
+        _wMassList("80.38"),
+        _linkCandidates(false),
+        _realSolution("abs minimum"),
+        _complexSolution("varied met"),
+        _metVariations("both"),
+        _allStrategies(false),
+        _solveQuadratic(0),
+        _solveComplex(0)
     {
         addSink("input", "Input");
         _output = addSource("output", "output");
@@ -37,6 +72,12 @@ class NeutrinoPz : public pxl::Module
         addOption("met name","name of the MET",_metName);
         addOption("lepton name","name of the lepton",_leptonName);
         addOption("neutrino name","name of the neutrino",_neutrinoName);
+        addOption("all leptons","solve for every lepton of the event view instead of the first one only; the neutrinos are linked to their lepton and get the user record 'wMass'",_allLeptons);
+        addOption("w masses","',' separated W mass hypotheses, one neutrino is created per lepton and hypothesis; with several hypotheses the neutrinos are linked to their lepton and get the user record 'wMass'",_wMassList);
+        addOption("real solution","solution taken if the W mass constraint has two real solutions: 'abs minimum', 'plus' or 'minus'",_realSolution);
+        addOption("complex solution","treatment of complex solutions: 'varied met' adjusts px,py of the MET to the closest real solution, 'real part' keeps the MET and takes the real part as pz",_complexSolution);
+        addOption("met variations","branches of the MET variation for complex solutions: 'both', 'minus' or 'plus'",_metVariations);
+        addOption("all strategies","additionally store the pz of every strategy as user records 'pz_<strategy>' of the neutrino",_allStrategies);
 
     }
 
@@ -73,255 +114,123 @@ class NeutrinoPz : public pxl::Module
         getOption("lepton name",_leptonName);
         getOption("met name",_metName);
         getOption("neutrino name",_neutrinoName);
+
+        getOption("real solution",_realSolution);
+        getOption("complex solution",_complexSolution);
+        getOption("met variations",_metVariations);
+        getOption("all strategies",_allStrategies);
+        getOption("all leptons",_allLeptons);
+        getOption("w masses",_wMassList);
+
+        _wMasses.clear();
+        size_t begin = 0;
+        while (begin<=_wMassList.size())
+        {
+            size_t end = _wMassList.find(',',begin);
+            if (end==std::string::npos)
+            {
+                end = _wMassList.size();
+            }
+            const std::string token = _wMassList.substr(begin,end-begin);
+            begin = end+1;
+            if (token.find_first_not_of(" \t")==std::string::npos)
+            {
+                continue;
+            }
+            char* tokenEnd = 0;
+            const double mW = strtod(token.c_str(),&tokenEnd);
+            if (tokenEnd==token.c_str() || token.find_first_not_of(" \t",tokenEnd-token.c_str())!=std::string::npos || !(mW>0))
+            {
+                throw std::runtime_error("invalid W mass '"+token+"'");
+            }
+            _wMasses.push_back(mW);
+        }
+        if (_wMasses.empty())
+        {
+            throw std::runtime_error("no W mass given");
+        }
+        _linkCandidates = _allLeptons || _wMasses.size()>1;
+
+        if (_realSolution=="abs minimum")
+        {
+            _solveQuadratic = &NeutrinoQuadraticBatch::solve<PzAbsMinimum>;
+        }
+        else if (_realSolution=="plus")
+        {
+            _solveQuadratic = &NeutrinoQuadraticBatch::solve<PzPlus>;
+        }
+        else if (_realSolution=="minus")
+        {
+            _solveQuadratic = &NeutrinoQuadraticBatch::solve<PzMinus>;
+        }
+        else
+        {
+            throw std::runtime_error("unknown real solution '"+_realSolution+"'");
+        }
+        _solveComplex = getComplexSolver(_complexSolution,_metVariations);
     }
 
     void endJob()
     {
     }
     
-    template <class T>
-    std::vector< T > const EquationSolve(const T & a, const T & b,const T & c,const T & d)
+    static ComplexSolver getComplexSolver(const std::string& complexSolution, const std::string& metVariations) throw (std::runtime_error)
     {
-      std::vector<T> result;
-
-
-      std::complex<T> x1;
-      std::complex<T> x2;
-      std::complex<T> x3;
-
-      if (a != 0) {
-        
-        T q = (3*a*c-b*b)/(9*a*a);
-        T r = (9*a*b*c - 27*a*a*d - 2*b*b*b)/(54*a*a*a);
-        T Delta = q*q*q + r*r;
-
-        std::complex<T> s;
-        std::complex<T> t;
-
-        T rho=0;
-        T theta=0;
-        
-        if( Delta<=0){
-          rho = sqrt(-(q*q*q));
-
-          theta = acos(r/rho);
-
-          s = std::polar<T>(sqrt(-q),theta/3.0);
-          t = std::polar<T>(sqrt(-q),-theta/3.0);
+        bool useMet = false;
+        if (complexSolution=="real part")
+        {
+            useMet = true;
         }
-        
-        if(Delta>0){
-          s = std::complex<T>(cbrt(r+sqrt(Delta)),0);
-          t = std::complex<T>(cbrt(r-sqrt(Delta)),0);
+        else if (complexSolution!="varied met")
+        {
+            throw std::runtime_error("unknown complex solution '"+complexSolution+"'");
         }
-      
-        std::complex<T> i(0,1.0);
-        
-        
-         x1 = s+t+std::complex<T>(-b/(3.0*a),0);
-         x2 = (s+t)*std::complex<T>(-0.5,0)-std::complex<T>(b/(3.0*a),0)+(s-t)*i*std::complex<T>(sqrt(3)/2.0,0);
-         x3 = (s+t)*std::complex<T>(-0.5,0)-std::complex<T>(b/(3.0*a),0)-(s-t)*i*std::complex<T>(sqrt(3)/2.0,0);
-
-        if(fabs(x1.imag())<0.0001)result.push_back(x1.real());
-        if(fabs(x2.imag())<0.0001)result.push_back(x2.real());
-        if(fabs(x3.imag())<0.0001)result.push_back(x3.real());
-
-        return result;
-      }
-      else{return result;}
-
-
-      return result;
+        if (metVariations=="both")
+        {
+            return useMet ? &solveComplexNu4Momentum<true,true,true,pxl::LorentzVector> : &solveComplexNu4Momentum<true,true,false,pxl::LorentzVector>;
+        }
+        else if (metVariations=="minus")
+        {
+            return useMet ? &solveComplexNu4Momentum<true,false,true,pxl::LorentzVector> : &solveComplexNu4Momentum<true,false,false,pxl::LorentzVector>;
+        }
+        else if (metVariations=="plus")
+        {
+            return useMet ? &solveComplexNu4Momentum<false,true,true,pxl::LorentzVector> : &solveComplexNu4Momentum<false,true,false,pxl::LorentzVector>;
+        }
+        throw std::runtime_error("unknown met variations '"+metVariations+"'");
     }
 
-
-    //..................................................................................................
-    /*
-    * Modification of code by Orso.
-    * WARNING! Use only pz component of the returned 4-momenta as the function adjusts the transverse
-    * component.
-    */
-
-
-    void solveNu4Momentum(pxl::Particle* neutrino, const pxl::LorentzVector& lepton, const float& metpx, const float& metpy)
+    //pz of every strategy applicable to the candidate
+    void storeAllStrategies(pxl::Particle* neutrino, const pxl::LorentzVector& lepton, unsigned icandidate)
     {
-
-        //solve real solution case
-        bool useNegativeDeltaSolutions_ = true;
-        //solve complex soultion case
-        bool usePositiveDeltaSolutions_ = true;
-
-        //in case of real solution use the abs min pz
-        bool usePzMinusSolutions_ = false;
-        bool usePzPlusSolutions_ = false;
-        bool usePzAbsValMinimumSolutions_ = true;
-
-
-        //vary px,py to find the solution in complex case
-        bool usePxMinusSolutions_ = true;
-        bool usePxPlusSolutions_ = true;
-
-        //set root=0 in complex case
-        bool useMetForNegativeSolutions_ = false;
-
-        double const mW = 80.38;
-
-        // double Wmt = sqrt(pow(lepton.et()+MET.pt(),2) - pow(lepton.getPx()+MET.getPx(),2) - pow(lepton.getPy()+MET.getPy(),2) );
-
-        double MisET2 = (metpx*metpx + metpy*metpy);
-        double mu = (mW*mW)/2 + metpx*lepton.getPx() + metpy*lepton.getPy();
-        double a = (mu*lepton.getPz())/(lepton.getE()*lepton.getE() - lepton.getPz()*lepton.getPz());
-        double a2 = pow(a,2.);
-        double b = (pow(lepton.getE(),2.)*(MisET2) - pow(mu,2.))/(pow(lepton.getE(),2) - pow(lepton.getPz(),2));
-        double pz1(0),pz2(0),pznu(0);
-        //int nNuSol(0);
-
-        pxl::LorentzVector p4nu_rec;
-        pxl::LorentzVector p4lep_rec;
-
-        p4lep_rec.setXYZ(lepton.getPx(),lepton.getPy(),lepton.getPz());
-        p4lep_rec.setE(lepton.getE());
-
-        neutrino->setUserRecord("radicand",a2-b);
-        //two real solutions exist
-        if((a2-b > 0)  && usePositiveDeltaSolutions_)
+        const double radicand = _batch.getRadicand(icandidate);
+        if (radicand>0)
         {
-            neutrino->setUserRecord("realsolution",true);
-
-
-            double root = sqrt(a2-b);
-            pz1 = a + root;
-            pz2 = a - root;
-            //nNuSol = 2;
-            if(usePzPlusSolutions_)
-            {
-                pznu = pz1;
-            }
-            if(usePzMinusSolutions_)
-            {
-                pznu = pz2;
-            }
-            if(usePzAbsValMinimumSolutions_)
-            {
-                pznu = pz1;
-                if(fabs(pz1)>fabs(pz2))
-                {
-                    pznu = pz2;
-                }
-            }
-
-            double Enu = sqrt(MisET2 + pznu*pznu);
-            p4nu_rec.setXYZ(metpx, metpy, pznu);
-            p4nu_rec.setE(Enu);
-            neutrino->setVector(p4nu_rec);
-
+            const double pzPlus = _batch.getPzPlus(icandidate);
+            const double pzMinus = _batch.getPzMinus(icandidate);
+            neutrino->setUserRecord("pz_absMinimum",PzAbsMinimum::select(pzPlus,pzMinus));
+            neutrino->setUserRecord("pz_plus",pzPlus);
+            neutrino->setUserRecord("pz_minus",pzMinus);
         }
-        //two complex solutions exist
-        else if ((a2-b < 0) && useNegativeDeltaSolutions_)
+        else if (radicand<0)
         {
-            neutrino->setUserRecord("realsolution",false);
-            // double xprime = sqrt(mW;
-
-            double ptlep = lepton.getPt(),pxlep=lepton.getPx(),pylep=lepton.getPy();
-
-            double EquationA = 1;
-            double EquationB = -3*pylep*mW/(ptlep);
-            double EquationC = mW*mW*(2*pylep*pylep)/(ptlep*ptlep)+mW*mW-4*pxlep*pxlep*pxlep*metpx/(ptlep*ptlep)-4*pxlep*pxlep*pylep*metpy/(ptlep*ptlep);
-            double EquationD = 4*pxlep*pxlep*mW*metpy/(ptlep)-pylep*mW*mW*mW/ptlep;
-
-            std::vector<long double> solutions = EquationSolve<long double>((long double)EquationA,(long double)EquationB,(long double)EquationC,(long double)EquationD);
-
-            std::vector<long double> solutions2 = EquationSolve<long double>((long double)EquationA,-(long double)EquationB,(long double)EquationC,-(long double)EquationD);
-
-
-            double deltaMin = 14000*14000;
-            double zeroValue = -mW*mW/(4*pxlep);
-            double minPx=0;
-            double minPy=0;
-
-            // std::cout<<"a "<<EquationA << " b " << EquationB <<" c "<< EquationC <<" d "<< EquationD << std::endl;
-
-            if(usePxMinusSolutions_)
+            const struct
             {
-                for( int i =0; i< (int)solutions.size();++i)
-                {
-                    if(solutions[i]<0 )
-                    {
-                        continue;
-                    }
-                    double p_x = (solutions[i]*solutions[i]-mW*mW)/(4*pxlep);
-                    double p_y = ( mW*mW*pylep + 2*pxlep*pylep*p_x -mW*ptlep*solutions[i])/(2*pxlep*pxlep);
-                    double Delta2 = (p_x-metpx)*(p_x-metpx)+(p_y-metpy)*(p_y-metpy);
-
-                    // std::cout<<"intermediate solution1 met x "<<metpx << " min px " << p_x <<" met y "<<metpy <<" min py "<< p_y << std::endl;
-
-                    if(Delta2< deltaMin && Delta2 > 0)
-                    {
-                        deltaMin = Delta2;
-                        minPx=p_x;
-                        minPy=p_y;
-                    }
-                    // std::cout<<"solution1 met x "<<metpx << " min px " << minPx <<" met y "<<metpy <<" min py "<< minPy << std::endl;
-                }
-            }
-
-            if(usePxPlusSolutions_)
-            {
-                for( int i =0; i< (int)solutions2.size();++i)
-                {
-                    if(solutions2[i]<0 )
-                    {
-                        continue;
-                    }
-                    double p_x = (solutions2[i]*solutions2[i]-mW*mW)/(4*pxlep);
-                    double p_y = ( mW*mW*pylep + 2*pxlep*pylep*p_x +mW*ptlep*solutions2[i])/(2*pxlep*pxlep);
-                    double Delta2 = (p_x-metpx)*(p_x-metpx)+(p_y-metpy)*(p_y-metpy);
-                    // std::cout<<"intermediate solution2 met x "<<metpx << " min px " << minPx <<" met y "<<metpy <<" min py "<< minPy << std::endl;
-                    if(Delta2< deltaMin && Delta2 > 0)
-                    {
-                        deltaMin = Delta2;
-                        minPx=p_x;
-                        minPy=p_y;
-                    }
-                    // std::cout<<"solution2 met x "<<metpx << " min px " << minPx <<" met y "<<metpy <<" min py "<< minPy << std::endl;
-                }
-            }
-
-            double pyZeroValue= ( mW*mW*pxlep + 2*pxlep*pylep*zeroValue);
-            double delta2ZeroValue= (zeroValue-metpx)*(zeroValue-metpx) + (pyZeroValue-metpy)*(pyZeroValue-metpy);
-
-            if(deltaMin<14000*14000)
+                const char* name;
+                ComplexSolver solve;
+            } strategies[] = {
+                {"pz_variedMet",&solveComplexNu4Momentum<true,true,false,pxl::LorentzVector>},
+                {"pz_variedMetMinus",&solveComplexNu4Momentum<true,false,false,pxl::LorentzVector>},
+                {"pz_variedMetPlus",&solveComplexNu4Momentum<false,true,false,pxl::LorentzVector>},
+                {"pz_realPart",&solveComplexNu4Momentum<true,true,true,pxl::LorentzVector>}
+            };
+            for (unsigned istrategy=0; istrategy<sizeof(strategies)/sizeof(strategies[0]); ++istrategy)
             {
-                // else std::cout << " test " << std::endl;
-
-                if(delta2ZeroValue < deltaMin)
-                {
-                    deltaMin = delta2ZeroValue;
-                    minPx=zeroValue;
-                    minPy=pyZeroValue;
-                }
-
-                // std::cout<<" MtW2 from min py and min px "<< sqrt((minPy*minPy+minPx*minPx))*ptlep*2 -2*(pxlep*minPx + pylep*minPy) <<std::endl;
-                /// ////Y part
-
-                double mu_Minimum = (mW*mW)/2 + minPx*pxlep + minPy*pylep;
-                double a_Minimum = (mu_Minimum*lepton.getPz())/(lepton.getE()*lepton.getE() - lepton.getPz()*lepton.getPz());
-                pznu = a_Minimum;
-
-                if(!useMetForNegativeSolutions_)
-                {
-                    double Enu = sqrt(minPx*minPx+minPy*minPy + pznu*pznu);
-                    p4nu_rec.setXYZ(minPx, minPy, pznu);
-                    p4nu_rec.setE(Enu);
-                }
-                else
+                pxl::LorentzVector p4nu_rec;
+                if (strategies[istrategy].solve(p4nu_rec,lepton,_batch.getMetPx(icandidate),_batch.getMetPy(icandidate),_batch.getA(icandidate),_batch.getWMass(icandidate)))
                 {
-                    pznu = a;
-                    double Enu = sqrt(metpx*metpx+metpy*metpy + pznu*pznu);
-                    p4nu_rec.setXYZ(metpx, metpy, pznu);
-                    p4nu_rec.setE(Enu);
+                    neutrino->setUserRecord(strategies[istrategy].name,p4nu_rec.getPz());
                 }
-                neutrino->setVector(p4nu_rec);
             }
         }
     }
@@ -333,46 +242,105 @@ class NeutrinoPz : public pxl::Module
             pxl::Event *event  = dynamic_cast<pxl::Event *> (sink->get());
             if (event)
             {
-                std::vector<pxl::EventView*> eventViews;
-                event->getObjectsOfType(eventViews);
+                _batch.clear();
+                _batchNeutrinos.clear();
+                _batchLeptons.clear();
+                _batchMETs.clear();
+
+                _eventViewIndex.build(event);
+                const std::vector<pxl::EventView*>& eventViews = _eventViewIndex.get(_inputEventViewName);
                 for (unsigned ieventView=0; ieventView<eventViews.size();++ieventView)
                 {
                     pxl::EventView* eventView = eventViews[ieventView];
-                    if (eventView->getName()==_inputEventViewName)
+                    std::vector<pxl::Particle*> particles;
+                    eventView->getObjectsOfType(particles);
+                    pxl::Particle* met=0;
+                    _viewLeptons.clear();
+                    for (unsigned iparticle=0; iparticle<particles.size();++iparticle)
                     {
-                        std::vector<pxl::Particle*> particles;
-                        eventView->getObjectsOfType(particles);
-                        pxl::Particle* met=0;
-                        pxl::Particle* lepton=0;
-                        pxl::Particle* neutrino=0;
-                        for (unsigned iparticle=0; iparticle<particles.size();++iparticle)
+                        pxl::Particle* particle = particles[iparticle];
+                        if (met==0 &&(particle->getName()==_metName))
+                        {
+                            met=particle;
+                        }
+                        if ((_allLeptons || _viewLeptons.empty()) &&(particle->getName()==_leptonName))
                         {
-                            pxl::Particle* particle = particles[iparticle];
-                            if (met==0 &&(particle->getName()==_metName))
+                            _viewLeptons.push_back(particle);
+                        }
+                    }
+                    if (met==0)
+                    {
+                        continue;
+                    }
+                    for (unsigned ilepton=0; ilepton<_viewLeptons.size(); ++ilepton)
+                    {
+                        pxl::Particle* lepton = _viewLeptons[ilepton];
+                        unsigned first = 0;
+                        for (unsigned imass=0; imass<_wMasses.size(); ++imass)
+                        {
+                            pxl::Particle* neutrino=eventView->create<pxl::Particle>();
+                            neutrino->setName(_neutrinoName);
+                            if (_linkCandidates)
+                            {
+                                neutrino->linkMother(lepton);
+                                neutrino->setUserRecord("wMass",_wMasses[imass]);
+                            }
+                            if (imass==0)
                             {
-                                met=particle;
+                                first = _batch.add(lepton->getVector(),met->getPx(),met->getPy(),_wMasses[imass]);
                             }
-                            if (lepton==0 &&(particle->getName()==_leptonName))
+                            else
                             {
-                                lepton=particle;
+                                _batch.addMass(first,_wMasses[imass]);
                             }
+                            _batchNeutrinos.push_back(neutrino);
+                            _batchLeptons.push_back(lepton);
+                            _batchMETs.push_back(met);
                         }
-                        if (met!=0 && lepton!=0)
+                    }
+                }
+
+                (_batch.*_solveQuadratic)();
+
+                for (unsigned icandidate=0; icandidate<_batch.size(); ++icandidate)
+                {
+                    pxl::Particle* neutrino = _batchNeutrinos[icandidate];
+                    pxl::Particle* lepton = _batchLeptons[icandidate];
+                    pxl::Particle* met = _batchMETs[icandidate];
+                    const double radicand = _batch.getRadicand(icandidate);
+                    neutrino->setUserRecord("radicand",radicand);
+                    //two real solutions exist
+                    if (radicand>0)
+                    {
+                        neutrino->setUserRecord("realsolution",true);
+                        pxl::LorentzVector p4nu_rec;
+                        p4nu_rec.setXYZ(_batch.getMetPx(icandidate),_batch.getMetPy(icandidate),_batch.getPz(icandidate));
+                        p4nu_rec.setE(_batch.getEnergy(icandidate));
+                        neutrino->setVector(p4nu_rec);
+                    }
+                    //two complex solutions exist
+                    else if (radicand<0)
+                    {
+                        neutrino->setUserRecord("realsolution",false);
+                        pxl::LorentzVector p4nu_rec;
+                        if (_solveComplex(p4nu_rec,lepton->getVector(),_batch.getMetPx(icandidate),_batch.getMetPy(icandidate),_batch.getA(icandidate),_batch.getWMass(icandidate)))
                         {
-                            neutrino=eventView->create<pxl::Particle>();
-                            neutrino->setName(_neutrinoName);
-                            solveNu4Momentum(neutrino,lepton->getVector(),met->getPx(),met->getPy());
-                            pxl::Particle p1;
-                            pxl::Particle p2;
-                            p1.getVector()+=met->getVector();
-                            p1.getVector()+=lepton->getVector();
-                            p2.getVector()+=neutrino->getVector();
-                            p2.getVector()+=lepton->getVector();
-                            neutrino->setUserRecord("mtw_beforePzSolution",sqrt(p1.getMass()*p1.getMass()+p1.getPx()*p1.getPx()+p1.getPy()*p1.getPy()));
-                            neutrino->setUserRecord("mtw_afterPzSolution",sqrt(p2.getMass()*p2.getMass()+p2.getPx()*p2.getPx()+p2.getPy()*p2.getPy()));
-                            //neutrino->setUserRecord("wmass_afterPzSolution",p2.getMass());
+                            neutrino->setVector(p4nu_rec);
                         }
                     }
+                    if (_allStrategies)
+                    {
+                        storeAllStrategies(neutrino,lepton->getVector(),icandidate);
+                    }
+                    pxl::Particle p1;
+                    pxl::Particle p2;
+                    p1.getVector()+=met->getVector();
+                    p1.getVector()+=lepton->getVector();
+                    p2.getVector()+=neutrino->getVector();
+                    p2.getVector()+=lepton->getVector();
+                    neutrino->setUserRecord("mtw_beforePzSolution",sqrt(p1.getMass()*p1.getMass()+p1.getPx()*p1.getPx()+p1.getPy()*p1.getPy()));
+                    neutrino->setUserRecord("mtw_afterPzSolution",sqrt(p2.getMass()*p2.getMass()+p2.getPx()*p2.getPx()+p2.getPy()*p2.getPy()));
+                    //neutrino->setUserRecord("wmass_afterPzSolution",p2.getMass());
                 }
 
                 _output->setTargets(event);
@@ -0,0 +1,348 @@
+/*
+* Benchmark and accuracy regression of the neutrino pz solution of
+* NeutrinoPz. A fixed sample of lepton and MET kinematics is generated from
+* a seeded generator: realistic W decays and extreme candidates with a large
+* MET compared to the lepton or a lepton with almost no px, which mostly end
+* up with a complex solution. The sample is solved like in the module with
+* the default strategies (smaller |pz|, varied MET) and the time per
+* candidate is reported separately for the real and the complex branch.
+*
+* The solved pz and the transverse mass of the lepton and neutrino are
+* compared to the reference in NeutrinoPzReference.hpp. The check fails if
+* the number of solutions differs or if a value deviates by more than the
+* tolerance relative to max(1,|value|). After an intended change of the
+* results the reference is regenerated with --write-reference.
+*
+* usage: NeutrinoPzBenchmark [repetitions]
+*        NeutrinoPzBenchmark --write-reference NeutrinoPzReference.hpp
+*
+* The random numbers are drawn from std::mt19937_64, whose sequence is fixed
+* by the standard, and transformed without the std distributions, whose
+* implementation differs between standard libraries.
+*/
+
+#include "NeutrinoSolver.hpp"
+#include "NeutrinoPzReference.hpp"
+
+#include <random>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+//changing the sample needs a new reference
+static const unsigned long BENCHMARK_SEED = 12345UL;
+static const unsigned BENCHMARK_NUM_REALISTIC = 2000;
+static const unsigned BENCHMARK_NUM_EXTREME = 500;
+
+//the parts of pxl::LorentzVector used by the solution
+class FourVector
+{
+    private:
+    double _x, _y, _z, _e;
+
+    public:
+    FourVector() : _x(0), _y(0), _z(0), _e(0)
+    {
+    }
+
+    double getPx() const { return _x; }
+    double getPy() const { return _y; }
+    double getPz() const { return _z; }
+    double getE() const { return _e; }
+    double getPt() const { return std::sqrt(_x*_x + _y*_y); }
+
+    void setXYZ(double x, double y, double z)
+    {
+        _x = x;
+        _y = y;
+        _z = z;
+    }
+
+    void setE(double e)
+    {
+        _e = e;
+    }
+};
+
+struct Candidate
+{
+    FourVector lepton;
+    float metpx;
+    float metpy;
+};
+
+class Generator
+{
+    private:
+    std::mt19937_64 _engine;
+
+    public:
+    Generator(unsigned long seed) : _engine(seed)
+    {
+    }
+
+    //uniform in [0,1) with 53 random bits
+    double uniform()
+    {
+        return (_engine()>>11)*(1.0/9007199254740992.0);
+    }
+
+    double uniform(double min, double max)
+    {
+        return min + (max-min)*uniform();
+    }
+
+    //Box-Muller, one of the two numbers is dropped to keep the sequence simple
+    double gauss(double mean, double sigma)
+    {
+        const double u1 = 1.0-uniform();
+        const double u2 = uniform();
+        return mean + sigma*std::sqrt(-2*std::log(u1))*std::cos(2*M_PI*u2);
+    }
+};
+
+static FourVector masslessVector(double pt, double eta, double phi)
+{
+    FourVector vector;
+    const double pz = pt*std::sinh(eta);
+    vector.setXYZ(pt*std::cos(phi),pt*std::sin(phi),pz);
+    vector.setE(std::sqrt(pt*pt + pz*pz));
+    return vector;
+}
+
+static void generateSample(std::vector<Candidate>& sample, unsigned numRealistic, unsigned numExtreme, unsigned long seed)
+{
+    Generator generator(seed);
+    for (unsigned i=0; i<numRealistic; ++i)
+    {
+        //lepton and neutrino of a W decay with resolution smeared MET
+        Candidate candidate;
+        const double leptonPt = 20 + std::fabs(generator.gauss(0,30));
+        candidate.lepton = masslessVector(leptonPt,generator.uniform(-2.5,2.5),generator.uniform(-M_PI,M_PI));
+        const double neutrinoPt = std::fabs(generator.gauss(35,20));
+        const double neutrinoPhi = generator.uniform(-M_PI,M_PI);
+        candidate.metpx = neutrinoPt*std::cos(neutrinoPhi) + generator.gauss(0,15);
+        candidate.metpy = neutrinoPt*std::sin(neutrinoPhi) + generator.gauss(0,15);
+        sample.push_back(candidate);
+    }
+    for (unsigned i=0; i<numExtreme; ++i)
+    {
+        Candidate candidate;
+        if (i%2==0)
+        {
+            //soft lepton with a large MET
+            const double leptonPt = generator.uniform(20,30);
+            candidate.lepton = masslessVector(leptonPt,generator.uniform(-2.5,2.5),generator.uniform(-M_PI,M_PI));
+            const double metPt = generator.uniform(200,1000);
+            const double metPhi = generator.uniform(-M_PI,M_PI);
+            candidate.metpx = metPt*std::cos(metPhi);
+            candidate.metpy = metPt*std::sin(metPhi);
+        }
+        else
+        {
+            //lepton along the y axis, the complex solution divides by its px
+            const double leptonPt = generator.uniform(20,100);
+            const double phi = (generator.uniform()<0.5 ? -0.5 : 0.5)*M_PI + generator.gauss(0,1e-4);
+            candidate.lepton = masslessVector(leptonPt,generator.uniform(-2.5,2.5),phi);
+            const double metPt = generator.uniform(50,300);
+            const double metPhi = generator.uniform(-M_PI,M_PI);
+            candidate.metpx = metPt*std::cos(metPhi);
+            candidate.metpy = metPt*std::sin(metPhi);
+        }
+        sample.push_back(candidate);
+    }
+}
+
+static double transverseMass(const FourVector& lepton, const FourVector& neutrino)
+{
+    const double mt2 = 2*(lepton.getPt()*neutrino.getPt() - lepton.getPx()*neutrino.getPx() - lepton.getPy()*neutrino.getPy());
+    return std::sqrt(mt2>0 ? mt2 : 0);
+}
+
+static double relativeDeviation(double value, double reference)
+{
+    return std::fabs(value-reference)/std::max(1.0,std::fabs(reference));
+}
+
+static bool writeReference(const char* fileName, const std::vector<double>& pz, const std::vector<double>& mtW)
+{
+    FILE* file = fopen(fileName,"w");
+    if (!file)
+    {
+        fprintf(stderr,"cannot open '%s'\n",fileName);
+        return false;
+    }
+    fprintf(file,"#ifndef _NEUTRINOPZREFERENCE_H_\n#define _NEUTRINOPZREFERENCE_H_\n\n");
+    fprintf(file,"// generated by NeutrinoPzBenchmark --write-reference, do not edit\n");
+    fprintf(file,"// pz and transverse mass of the benchmark sample, NAN if there is no solution\n\n");
+    fprintf(file,"#include <cmath>\n\n");
+    fprintf(file,"static const unsigned long REFERENCE_SEED = %luUL;\n",BENCHMARK_SEED);
+    fprintf(file,"static const unsigned REFERENCE_NUM_REALISTIC = %u;\n",BENCHMARK_NUM_REALISTIC);
+    fprintf(file,"static const unsigned REFERENCE_NUM_EXTREME = %u;\n\n",BENCHMARK_NUM_EXTREME);
+    const std::vector<double>* values[2] = {&pz,&mtW};
+    const char* names[2] = {"REFERENCE_PZ","REFERENCE_MTW"};
+    for (unsigned ivalues=0; ivalues<2; ++ivalues)
+    {
+        fprintf(file,"static const double %s[] = {",names[ivalues]);
+        for (unsigned i=0; i<values[ivalues]->size(); ++i)
+        {
+            const double value = (*values[ivalues])[i];
+            fprintf(file,"%s",i%4==0 ? "\n    " : " ");
+            if (std::isnan(value))
+            {
+                fprintf(file,"NAN,");
+            }
+            else
+            {
+                fprintf(file,"%.17g,",value);
+            }
+        }
+        fprintf(file,"\n};\n\n");
+    }
+    fprintf(file,"#endif\n");
+    fclose(file);
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    const char* referenceFileName = 0;
+    long repetitions = 2000;
+    if (argc>2 && strcmp(argv[1],"--write-reference")==0)
+    {
+        referenceFileName = argv[2];
+    }
+    else if (argc>1)
+    {
+        repetitions = std::max(1L,atol(argv[1]));
+    }
+    //largest accepted deviation relative to max(1,|value|)
+    const double tolerance = 1e-6;
+    const double mW = 80.38;
+
+    std::vector<Candidate> sample;
+    generateSample(sample,BENCHMARK_NUM_REALISTIC,BENCHMARK_NUM_EXTREME,BENCHMARK_SEED);
+    const unsigned numCandidates = sample.size();
+
+    NeutrinoQuadraticBatch batch;
+    for (unsigned i=0; i<numCandidates; ++i)
+    {
+        batch.add(sample[i].lepton,sample[i].metpx,sample[i].metpy,mW);
+    }
+
+    //the timing of the real branch includes the candidates with complex solutions
+    //since the batch solves them without branches
+    double checksum = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (long irepetition=0; irepetition<repetitions; ++irepetition)
+    {
+        batch.solve<PzAbsMinimum>();
+        checksum += batch.getPz(irepetition%numCandidates);
+    }
+    const double quadraticTime = std::chrono::duration<double,std::nano>(std::chrono::steady_clock::now()-start).count();
+
+    std::vector<unsigned> complexCandidates;
+    for (unsigned i=0; i<numCandidates; ++i)
+    {
+        if (batch.getRadicand(i)<0)
+        {
+            complexCandidates.push_back(i);
+        }
+    }
+
+    FourVector neutrino;
+    start = std::chrono::steady_clock::now();
+    for (long irepetition=0; irepetition<repetitions; ++irepetition)
+    {
+        for (unsigned j=0; j<complexCandidates.size(); ++j)
+        {
+            const unsigned i = complexCandidates[j];
+            solveComplexNu4Momentum<true,true,false>(neutrino,sample[i].lepton,sample[i].metpx,sample[i].metpy,batch.getA(i),mW);
+            checksum += neutrino.getPz();
+        }
+    }
+    const double complexTime = std::chrono::duration<double,std::nano>(std::chrono::steady_clock::now()-start).count();
+
+    std::vector<double> pz(numCandidates,NAN);
+    std::vector<double> mtW(numCandidates,NAN);
+    for (unsigned i=0; i<numCandidates; ++i)
+    {
+        bool solved = true;
+        if (batch.getRadicand(i)>=0)
+        {
+            neutrino.setXYZ(batch.getMetPx(i),batch.getMetPy(i),batch.getPz(i));
+            neutrino.setE(batch.getEnergy(i));
+        }
+        else
+        {
+            solved = solveComplexNu4Momentum<true,true,false>(neutrino,sample[i].lepton,sample[i].metpx,sample[i].metpy,batch.getA(i),mW);
+        }
+        if (solved)
+        {
+            pz[i] = neutrino.getPz();
+            mtW[i] = transverseMass(sample[i].lepton,neutrino);
+        }
+    }
+
+    if (referenceFileName)
+    {
+        return writeReference(referenceFileName,pz,mtW) ? 0 : 1;
+    }
+
+    printf("candidates:               %u (realistic %u, extreme %u)\n",numCandidates,BENCHMARK_NUM_REALISTIC,BENCHMARK_NUM_EXTREME);
+    printf("complex solutions:        %lu\n",complexCandidates.size());
+    printf("real branch:              %.2f ns/candidate\n",quadraticTime/(double(repetitions)*numCandidates));
+    if (complexCandidates.size()>0)
+    {
+        printf("complex branch:           %.2f ns/candidate\n",complexTime/(double(repetitions)*complexCandidates.size()));
+    }
+    printf("checksum:                 %g\n",checksum);
+
+    if (REFERENCE_SEED!=BENCHMARK_SEED || REFERENCE_NUM_REALISTIC!=BENCHMARK_NUM_REALISTIC || REFERENCE_NUM_EXTREME!=BENCHMARK_NUM_EXTREME)
+    {
+        printf("reference was written for a different sample, regenerate it with --write-reference\n");
+        printf("FAILED\n");
+        return 1;
+    }
+
+    long numMismatches = 0;
+    long numCompared = 0;
+    double maxPzDeviation = 0;
+    double maxMtWDeviation = 0;
+    double sumPzDeviation = 0;
+    double sumMtWDeviation = 0;
+    bool pass = true;
+    for (unsigned i=0; i<numCandidates; ++i)
+    {
+        if (std::isnan(pz[i]) || std::isnan(REFERENCE_PZ[i]))
+        {
+            numMismatches += std::isnan(pz[i])!=std::isnan(REFERENCE_PZ[i]);
+            continue;
+        }
+        ++numCompared;
+        const double pzDeviation = std::fabs(pz[i]-REFERENCE_PZ[i]);
+        const double mtWDeviation = std::fabs(mtW[i]-REFERENCE_MTW[i]);
+        maxPzDeviation = std::max(maxPzDeviation,pzDeviation);
+        maxMtWDeviation = std::max(maxMtWDeviation,mtWDeviation);
+        sumPzDeviation += pzDeviation;
+        sumMtWDeviation += mtWDeviation;
+        if (!(relativeDeviation(pz[i],REFERENCE_PZ[i])<=tolerance && relativeDeviation(mtW[i],REFERENCE_MTW[i])<=tolerance))
+        {
+            pass = false;
+        }
+    }
+    const double norm = numCompared>0 ? numCompared : 1;
+
+    printf("solution count mismatches: %li\n",numMismatches);
+    printf("pz deviation:             max %g GeV, mean %g GeV\n",maxPzDeviation,sumPzDeviation/norm);
+    printf("mtW deviation:            max %g GeV, mean %g GeV\n",maxMtWDeviation,sumMtWDeviation/norm);
+
+    pass &= numMismatches==0;
+    printf("%s\n",pass ? "PASSED" : "FAILED");
+    return pass ? 0 : 1;
+}
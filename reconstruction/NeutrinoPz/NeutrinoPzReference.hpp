@@ -0,0 +1,1269 @@
+#ifndef _NEUTRINOPZREFERENCE_H_
+#define _NEUTRINOPZREFERENCE_H_
+
+// generated by NeutrinoPzBenchmark --write-reference, do not edit
+// pz and transverse mass of the benchmark sample, NAN if there is no solution
+
+#include <cmath>
+
+static const unsigned long REFERENCE_SEED = 12345UL;
+static const unsigned REFERENCE_NUM_REALISTIC = 2000;
+static const unsigned REFERENCE_NUM_EXTREME = 500;
+
+static const double REFERENCE_PZ[] = {
+    17.85989287339147, 13.090244559881739, 55.672612926409386, -36.0081973385211,
+    27.087203184265661, -24.291825913378489, -85.604168861424071, -19.192443332345711,
+    13.63071893712231, -13.517558399523864, 6.9726213055470581, -15.22311568773817,
+    -85.058295987155176, 2.3985342971092223, -13.481758013497075, -1.0521804599394002,
+    -6.4447060316076517, -2.0550379968195784, -2.7757742712865223, -23.330686165845378,
+    18.181717894171129, 17.418835812660646, 22.807993208117125, -123.51026072628264,
+    213.6149186703467, 79.832676504253982, -181.92545693771208, 12.436063017711675,
+    17.323803521734192, -49.102302718325674, 84.358895591728697, -57.765494576366478,
+    -6.1507979277174485, -156.56508247175697, -119.17453952127562, 77.218059202321712,
+    -45.542914486657708, 14.669252217143924, -23.92900499051359, -33.188934555794617,
+    52.514390967734869, 15.757441113491424, 58.480414148874047, -24.581776307745258,
+    -56.773438990384506, 63.728284908026502, -9.0790053897930463, -183.05704037344219,
+    -23.531945146499154, 3.3489937735449757, -24.97679898646966, -29.304090114645206,
+    -17.499005139778411, -36.948999213551332, -26.618318434267039, 4.9655829814361709,
+    26.783845624171342, -154.52950273170143, -0.10530128271574313, 17.559901675581614,
+    -4.1790997630291002, -13.697012096398026, -103.57877759030636, 32.650229451295473,
+    -11.853555157351138, -23.678781945848698, 32.182784425923586, -1.1557085055632257,
+    -54.810269617073573, -20.890426003815179, -16.008768021738035, 3.488975880590977,
+    260.83182302663892, -3.1558432255941966, 12.305998217390709, 155.9168869562188,
+    16.733148332765239, 11.71720953115269, 11.44969412984338, 55.817647369883616,
+    -97.219962650160397, 13.039884480670182, -11.125190879567185, 41.014381359210006,
+    -41.061695154042809, 72.87365509462056, 54.473521357412892, -41.259307533466611,
+    45.640443022559623, -6.5661085218384301, -9.0498271061736801, 91.431651248705549,
+    -5.9175118116454257, -3.3921877390949646, -22.416234822182624, 36.071682383989327,
+    338.6073949194128, 68.405771056448472, -11.003841558418728, -50.566489521883796,
+    -2.0450818158258244, -12.129121250567389, -53.712085240179015, -18.466750559551492,
+    -0.83854879670747096, -33.359969850459507, 25.294097642337988, 3.0938151419931899,
+    10.826882632659306, 75.639425936522329, 7.4902588157196419, -33.868079665950361,
+    -12.992883494364882, 16.096529956650102, 27.825205624289914, 5.502892251936828,
+    -27.208656455340787, -146.39171328783843, -61.778246247675327, -4.8640631601659265,
+    12.954476646079286, -6.7925016190532004, 16.49235825342646, -13.268279461956411,
+    7.1440878659848401, 19.948695328715075, 11.476856596134326, -42.806767554600469,
+    97.513331453895788, 12.589893263545463, -0.45265378146683588, -9.8065460786036169,
+    -62.67548901915891, 19.310572562370652, 1.3862964700399316, 81.057698617786684,
+    -4.6141450043122632, 110.61283733099864, 49.236443032839738, -81.747044816819511,
+    120.07178376788312, 8.9327935225252304, 11.555599081873247, 23.212604112714473,
+    37.037748795964944, 23.473533232039131, 39.506678831867816, -1.5829821137969589,
+    -10.103815549245153, 471.22815398581884, -173.10109422702305, -5.143031147434499,
+    -14.116120937502336, 76.757261945269917, -139.90809476427128, 141.86022781546242,
+    132.61514820463384, -8.1598064986114913, 93.64103675824046, 12.778424071202963,
+    -16.743283220329886, 136.45244981254808, -23.647529152134041, -12.511206170771713,
+    -81.572974933383492, 26.22735752760309, 8.0274227009197716, -4.0825075423282442,
+    82.529613788167836, 47.022548445308011, 14.126358508816487, 25.740412491722488,
+    77.920387626604352, 45.833542210363817, -23.118883559131323, 74.157699024515139,
+    17.485095588082658, -117.06320644686673, 23.243683893452474, 32.742376840511156,
+    -0.64504266305561941, -87.709405025746037, -45.75550076724506, 2.1364166346395876,
+    0.48690305891585695, -8.6965363811237921, -135.44012702835352, -43.740175474564921,
+    -28.165394840971459, -57.582672052881236, 54.626491000604688, -38.26296904887991,
+    -63.902106788519824, -29.126570930583227, 17.910585801820019, 23.991534867448308,
+    -46.099122601915724, -11.496298063003735, 3.6274742708990289, -35.323243236358472,
+    26.1502199646619, -7.2447718378336958, -71.572673098533159, 122.26502055884069,
+    13.563240653192906, 36.079743853745228, -10.808045106471184, -8.4156145133882774,
+    -22.010583001402779, 13.285423961293032, 68.096096102233361, 40.624112866938539,
+    -14.352730861005284, 15.687245247265977, -11.090696257294887, -1.7204831674226568,
+    -34.277852315094236, 14.318218935594231, 87.513906330645312, -10.858718179297398,
+    -194.63126707844216, 69.846401824700507, -0.75974394068697393, 13.117851643846478,
+    94.882978316512208, 11.187274197552426, 63.467880626204739, -71.726371486530056,
+    -47.822246024900132, 24.210083788236645, 26.11897124003076, 17.821634029398879,
+    12.11637745531868, -25.879028540156128, -115.3010579741083, 148.71512169635673,
+    -95.155751125617712, 49.070453014290123, 96.405741297320446, -41.156329792057136,
+    -15.913457496865227, 32.331171859618678, -133.84761135900752, -34.510355812085947,
+    -55.534178746887861, 27.017676976950838, 26.816240213427065, -132.7082338562337,
+    -39.446539743238475, -6.2842417910039785, 8.8629112105777281, 13.082255280609218,
+    76.35845725542427, -20.325875433145995, 24.373149872941667, 31.600685254547891,
+    17.953445705232639, 40.757904387713985, 52.106951327227478, 28.200265644647807,
+    -29.473033977172008, -45.030243847738461, 39.564400673831649, 57.98403605785677,
+    -101.09842600378354, -15.623950832725825, 33.219405702359438, -29.773996605375388,
+    -25.176858385696221, -241.30473470120253, -54.60331137808673, 15.229381280915703,
+    109.54295749791757, 95.834045750866068, -3.5764689261476406, 96.395520272207051,
+    25.928185167970639, -11.803507488232754, 45.873139758276281, 31.511367496978608,
+    -44.686651299023964, -134.89163192979473, -37.141173495095927, 19.975021020021742,
+    70.259303062805785, 14.044739410018195, 15.151657508365531, -10.811930197160903,
+    108.89639810137635, -44.230940547364597, 120.50836535579836, -161.63953244480291,
+    83.967876604407905, -66.36214231604437, -41.594979534616627, 197.17193689177222,
+    42.060529112624522, 168.82390405968184, 84.639748646134763, 95.941222845070826,
+    8.508892455175328, 19.203370207844728, 50.719970852373336, 25.792753563312186,
+    10.424693585784439, -64.336621103606547, 3.8973014499901928, 96.800833557625822,
+    8.6453785525999933, 35.964090947778857, -13.374581955714845, 19.809810228523187,
+    -142.82294088807876, -27.556998976849172, 38.694555978108895, -93.415672342116736,
+    -260.24426027641863, -16.718190850220452, -75.196807477096371, 1.1697270917633205,
+    -12.986344719376731, 90.289713793010122, -26.444283357500751, -13.85718397603938,
+    121.40671560668397, 6.389555193274802, -68.046398688337476, 51.765369132192006,
+    -0.50839657867527421, -39.720609556918788, -15.29163419503297, -283.10475293344962,
+    -82.180903439564119, 31.569201154152935, -34.582729789242535, -106.65448081017338,
+    -89.925785196733671, -40.181522128745904, -74.18380834767045, -118.53902717487145,
+    -12.173528889192198, -10.520909936235228, -8.9256962614720692, -30.260855540452212,
+    -53.417290138589763, 3.2543254718185071, -51.540720399035081, 246.45264582998874,
+    -90.62376637579905, 17.741481899543331, -86.840011638124807, -59.993952695285877,
+    75.277808411527786, 4.3799909024896522, 100.45959239230604, 52.951238870657285,
+    -49.809254030590409, -66.468752603500278, 192.71560955428129, 24.0517032547761,
+    -8.6743904175883699, -16.271189312490236, 51.638433346847485, -13.957351514611645,
+    -4.0441091819113808, -43.521603605149309, 13.011090850596815, -87.832448575064035,
+    -60.176842400118218, -1.5331142120041932, 0.57097703002551725, 58.689616744508868,
+    61.686709156401577, -1.4197409851274898, 24.282657003888495, 42.786506008260069,
+    116.75670681372121, 156.94491545171803, 38.957900938374394, -35.167795949664736,
+    -8.8404677648606764, -39.363629881445036, 18.317321974744228, -116.39324096953,
+    -4.936921207688215, 1.6268687166206632, 77.412041583559599, 8.9638696187198548,
+    -97.507188855860079, -25.866454166147875, -48.300591929098012, 228.01088552762769,
+    -101.90185726566523, -23.148135378737152, -9.9378216623181146, -60.168703536978292,
+    15.984353054128261, -9.2053889693074211, -21.996901669543263, 30.278325611222726,
+    147.25189190496951, 59.586194119128564, -377.60305886327228, 5.3451424770698566,
+    -141.59081550304512, -103.09206263235384, -78.859222021051039, 106.92774565638626,
+    43.806880699389183, -8.2452114351814316, -12.455777318530863, -6.5727696630645482,
+    -32.62684308004404, -19.891671226198113, 0.024293525570897145, -69.521963490183452,
+    -7.6892030729779517, -0.9918340128940315, 263.69323396739844, 36.143349111225135,
+    -24.849712035179685, 0.4397752681898055, 56.85598830019336, -0.026702623221297017,
+    38.546829050785163, 36.992017787110399, 8.1112379285996212, 6.9497516688500696,
+    -2.7324161685737636, 33.784294169858356, -31.001284391421621, 33.713491821348953,
+    24.878586451865576, -207.32326001419179, -19.582575112533618, -83.092246257133382,
+    138.65725531687468, -70.516969904161726, -7.555123121519614, -207.67464019654508,
+    -16.672238896676902, 38.368741333739081, -46.820101580936651, 40.41352404754813,
+    -86.847328775306238, -78.929194604492608, 35.972272291864201, -109.37923562038755,
+    -25.892723713040596, -130.87564329228047, 18.17408153017351, 11.478141611541275,
+    0.33202631664255478, 196.72080499654214, -35.205556643424984, 67.866025477991073,
+    33.849508657744295, -51.512373804012263, 89.116679769025012, -12.950069821866975,
+    -23.512694019974674, -83.113899212931472, 25.929694266242258, 6.6125089678018902,
+    -31.230734798308987, 28.576282241946807, 62.639315217277073, 71.095040476325067,
+    -5.7169962255700852, -10.920300389704721, -16.510685175478262, -0.15702246743083492,
+    69.28323891594556, -20.506164596614511, -3.5646485539119794, -11.28946545893141,
+    -56.97411530093477, -18.065372783645266, -43.410424408275929, -1.0738109498057327,
+    6.7341182248446216, -109.93799954802054, -1.1707486449043358, -133.52502048164138,
+    -12.879442548350255, -14.358398905188366, -14.610893606869197, -42.021271365923724,
+    59.458895237867296, -23.882263518184828, 14.111925121692252, 32.923574136615201,
+    51.653725811143836, 1.8461833421665119, -21.817071020527422, 29.686540321305984,
+    -64.57173479380323, 69.656984046052088, -31.052381860766957, -42.885446130078734,
+    10.833404665516611, -7.971181095876517, 34.767818582012708, 3.5484698641209889,
+    -24.211190919267608, 95.461517769177902, -14.92645731194375, -24.922721070421098,
+    50.407160306283487, -70.420929844719836, 19.722333866772239, -32.925680783356881,
+    -233.6420740764699, 45.895090700806023, -15.050582361601556, -115.56815289572856,
+    -13.215023752965749, -78.247199286102514, 21.300130057964758, -23.852338033529094,
+    -14.954214809787146, -17.443332063402067, -24.540848668746008, -22.341203112234496,
+    -22.204211563233173, 55.162716563680036, -11.412643829647138, 40.346576103005049,
+    -79.641044900558597, -5.8671953113174595, -10.377498374206567, -26.027418065087204,
+    -20.222756630640333, 33.261793144826555, -42.248134911104728, -17.307452915021656,
+    -48.482398792631592, -95.161454760908356, -0.2589565086528296, -19.575238901602972,
+    2.7437514785288499, 16.964569029251408, 32.220637381535568, 35.301638531623638,
+    -13.133946829881836, -55.310340295951235, -81.50211877253291, 5.1845703661485629,
+    20.337667429786848, 28.34963364952992, -25.966984605596167, -12.630920516751473,
+    -37.089472855582528, 155.3523894153175, -17.20081086613547, 32.095447525916825,
+    -166.12958713552854, -83.201920009942086, -14.710409281445735, 2.1019306892151235,
+    -10.635287074313339, 27.203429875415054, 33.112229521410185, 10.346684246989099,
+    -21.721989797803445, -49.61704112276913, -3.3115090521172021, -39.743084287943674,
+    35.231910675097623, -12.07005375590478, 43.448829230031265, -17.429399399742763,
+    -45.712493975779495, -23.549235308971774, -98.385853333444942, 5.8323398126599102,
+    75.44743959942987, 3.5896346686611764, -9.2208640357916352, 46.78187283271771,
+    109.78794675463838, -17.208897464326782, 215.42030246561103, 35.782248912972079,
+    -53.531403963979201, -19.406961779642302, -52.827437282354367, 8.0622001642466472,
+    -8.8587839038347624, 104.81717743035368, -19.980841604972852, 98.406472899272387,
+    -21.908694262911833, -86.107438845758281, 118.86109680215164, 2.3743035911087702,
+    54.82069713616098, -232.80972095518598, -24.93490199092389, 31.226906689940595,
+    97.551503254305288, -28.203535522525158, 80.452853304727569, 15.755074379540531,
+    98.38823304256195, 84.789066195125798, 17.027539939390749, 86.563588279382245,
+    46.485705641174533, -2.2191376056575498, -17.121120250566008, -20.289117667875644,
+    -7.2862772875102699, -52.627593281356013, -35.051132535496137, 125.83409027517268,
+    5.9366094196784047, 0.12701850591267316, 13.948086994863843, 121.69491659247694,
+    -217.32806104784112, 6.4310334520915831, -1.7777985312708324, -57.548333396594671,
+    182.49846459579771, 12.080527491547086, 20.136069314345008, -8.7782537237508222,
+    13.595790963775055, -39.738109757042942, -37.056312921690427, 210.74477993641122,
+    182.57263359224183, -14.536487833743649, 10.35584594691386, 11.279911051293542,
+    23.704424595424769, -26.870069220754534, -3.2296881416794463, -50.248495144362828,
+    -6.8861522297357851, 11.997148916447031, 28.898509135689864, -18.92021865544244,
+    82.241169773508858, -18.613239544964586, 13.119279841347016, 30.295638705726141,
+    27.375353741528954, -2.9790504358921055, -65.721573357035439, 33.564041186656851,
+    -31.300568134123239, -27.737575827280352, -22.884222670389978, -78.678539669181504,
+    71.593417284844151, -5.1514646469075842, 0.090014354408722852, -16.207663442482946,
+    18.680897198848584, 47.934453143856615, 106.39108275570226, -45.691966473329728,
+    29.755714214490411, -7.1254905143633493, 24.896236372426827, 18.065640746464737,
+    -45.649899316436098, -10.754561342397764, 108.3588646447415, -15.576864597968012,
+    -18.828414301289598, 50.008698953019405, -52.717384078969019, 183.63247819727229,
+    -14.087282563298391, -212.44799518910756, -12.934578003020363, -12.488826226164491,
+    -46.292374675685267, -46.842691519608991, -108.43702556283395, -6.4698020027296934,
+    -1.1996356181833825, 30.961595848451051, 107.8223149132066, -88.982189337220674,
+    1.7588469462550336, 17.927888466174718, -55.298005041691511, 17.630156232382433,
+    -112.01565340480207, -14.507211734973772, 1.4495149541284178, -27.15744274407632,
+    112.43430115043238, -6.6545478290487381, -26.988971970381314, -11.788980218705092,
+    -144.1298404121184, -12.812922589427387, 2.5240143802278396, 7.2340423916995746,
+    19.454258001108428, -9.3896012068962591, -121.99671220248882, -8.7578325442532332,
+    1.561789054360645, 103.88650118098619, -338.97447602590751, -11.722639914204535,
+    81.150708604189049, 16.957731143541992, -91.176695957937739, 35.299106219649218,
+    70.813412851103806, 43.58398701980127, 1.9807157968014337, -68.326429273887186,
+    -4.2401679704436788, -49.49353706582167, 70.646068720581724, 22.360348591504987,
+    -189.88353316232551, 9.2248661297240915, -6.8014018851503977, -8.662815882566278,
+    -12.689250968251145, -69.774210386118995, 30.202987267622063, 60.697516541820391,
+    -7.1351575612152374, 17.864444335980465, 170.54416924968544, -38.853806766617467,
+    -23.018819701266281, -20.603806652253539, -5.7616891087943225, 38.675553647393961,
+    36.175865589462077, -52.26093838216724, -28.905571699099184, -93.706553503630744,
+    20.969115812972291, -81.862693056223222, 3.5463811641898815, 5.8591103781219402,
+    35.041333902932031, -53.371163456292919, -10.146300795350299, 2.455495860573873,
+    92.178907242500685, 33.078613264578429, 50.480493645213414, 60.818463298261818,
+    104.67252552574206, 10.269772829782823, -13.678595833199836, -34.298346421824817,
+    -64.057750328253519, 74.026570124671252, 80.153521467523007, 30.062767408235715,
+    9.5977949354397651, -80.290297431789909, 35.455262136850422, 63.750428587612596,
+    -24.697462100382069, -54.964958299783248, 16.973558950544543, -14.623717126815883,
+    71.777424634461099, 50.917032985669394, 56.714470152826493, -90.68748358139004,
+    81.175781294242483, 75.984923495421441, 91.201058853381255, -11.715496928812017,
+    -67.026085549545087, 13.845502617892635, 23.250818058075183, -127.56975919938547,
+    26.308584975545955, 17.322070113298778, -0.47535559731731203, 47.818856620745194,
+    -70.077343845896721, 5.6655746311654411, 16.154492662691894, -34.160870388304829,
+    -45.947982405668625, 17.016283561938739, 55.137655507628089, -83.967628472593987,
+    -1.7529941605780408, 73.297687626243032, 78.983380108082656, 37.371191459016629,
+    49.093496579196355, -13.322455262971687, -157.82305705446265, -28.132649585459461,
+    22.123194874620975, 19.149444605760387, 4.821967339948543, -12.569245921529557,
+    4.6035915808350865, 61.385248469603731, -2.3312719100663912, 21.354930905266784,
+    -14.822955156307003, 5.1135429414276814, 29.18558453612448, -35.880676238164227,
+    -36.421392228211666, -25.090578512757048, -25.879043907708621, 211.49388295956314,
+    -170.88510064390709, -5.2251552176032874, 16.539396792717184, 24.54505524143832,
+    4.4727594918999216, 21.014544715948318, 24.295881915913156, 32.723140809775941,
+    41.407224474353889, -3.4552791414370247, 1.5273899866805039, 17.385955635534302,
+    -117.12603074118805, -43.661644791811796, 20.242370031366988, 14.388569938142524,
+    -31.367671285276664, -34.378736980856388, -0.42075786244723512, -107.8240650303901,
+    -33.920527492046354, -35.211232895593724, -9.6562699700131134, 18.901105764789435,
+    28.087138156661304, 33.463136004018679, -9.7955418714933558, 13.112534417074926,
+    -162.48724736941233, 112.70248741827201, -54.799432494700639, 63.39414671935733,
+    329.78720153048624, 122.60586295754588, 6.0909968624514335, -54.314729507554347,
+    -153.85647960392478, 8.6450169908528807, 75.963719400695126, 139.85575762958302,
+    -158.98013699869688, 33.962919778081954, -102.7426668642068, 10.065664315391359,
+    -82.851693262042872, -34.399341329074545, 83.372967091457213, 22.950438865061244,
+    37.189390168830748, 19.499932492941987, 1.936325417385433, -114.4348983530172,
+    13.673645475163028, 29.471422668121193, 59.966719947405586, 12.889551203261078,
+    50.918399736654706, -50.371671000287961, -41.289681887157116, 61.929311933934429,
+    132.32225429596269, 19.207691400239717, -22.808459965052663, -60.064394247148876,
+    -2.995102998256618, -24.331825466121732, -8.280657233858463, -68.714559932387075,
+    0.86076317754798215, -18.796518594691349, 170.53148398522876, -34.984372746789298,
+    10.258202937996607, -16.122243680518352, -114.7531326070262, 45.138924943086067,
+    37.609531174006015, -56.566429946217802, -112.44513645220374, -20.74393996534036,
+    -45.586753051073131, 26.224549163148826, 4.1667692269568306, 29.755134509806624,
+    69.560961976450471, -85.108825425285801, 121.99729012094133, 2.302169141849248,
+    -79.990723796835937, -1.2556254604947412, -4.7163852386232037, 72.244923663708079,
+    13.852789527236951, -80.0497677183983, -4.9655051303281539, 6.7555527428745563,
+    39.711932270402421, 5.5712579758959748, -39.685911200178033, 5.7961198732268713,
+    67.587645642338543, -97.526172930651398, -10.795702420976539, 58.910146489277324,
+    -7.6698279747852496, -67.587950284180494, 83.745148963033472, -28.074641150860941,
+    -12.205229364584184, -3.997707407842654, -60.332983932401717, 118.87407542116301,
+    20.945186177811252, 3.0623648623992747, -95.191076682746285, 57.059317774023214,
+    -2.4157258295697375, 94.57984991301646, -59.971286472693791, -95.443670672067867,
+    180.01298251631084, 4.3643631014706443, 49.916503507732401, 2.6089215560276955,
+    -12.719591605910807, -46.493587752831274, 83.565721765097507, 19.449819542760995,
+    -21.248074857426328, -81.1246022204718, -22.164332732938526, -24.516017516093374,
+    1.7427067579267543, -39.508176455868984, 37.169880528102382, 0.53005332881565437,
+    -15.773014132040174, -34.495357300397458, -66.130221967561795, 54.997884572164878,
+    167.94291384456525, 9.5328771297247936, -23.240632652005925, -35.168772718349572,
+    238.21095115987742, 10.647733490920402, 29.373359820092446, 70.683629810327446,
+    54.830110774863734, 27.341627035808415, -60.768935123425521, -55.186107539135122,
+    19.503027195584664, -48.217616572819061, 173.23192767914151, -13.444948515204828,
+    52.893756488892606, 22.436500542293956, -52.688954632520129, 9.9603361747726922,
+    -137.68334356587175, -75.66668837982786, 42.474108743316023, -43.065487796074763,
+    -61.391602584897278, 18.427796965856601, 65.782299955749636, -18.224673292859379,
+    27.348413734098401, 25.828123067821963, 76.141760097335677, 91.762646255032237,
+    -47.232094214794472, -38.939005548236629, -19.421976971875125, -105.10594917568439,
+    14.426047327230378, 13.725106661526297, 27.993316346763805, -4.5133656635425723,
+    -29.427319849853006, 98.414262330061092, 21.957796375282612, 15.614817970388827,
+    -17.940351748354203, -20.960386154547166, 50.682004693753221, -8.1114475253864384,
+    88.18901249028724, 43.070493428140793, -99.933138669517248, -31.609564756666714,
+    -3.433396316494111, 63.977440246148106, 80.835133899297986, 264.13188003328281,
+    139.83801077752656, 83.451689000190981, -7.1964330723502243, -71.533024417568328,
+    -75.654051579767042, 10.486673795898783, -16.012117335072659, 36.102077463274895,
+    -7.598708762824856, -61.530615480886425, -23.896368395870468, -32.187107653151351,
+    63.848470199473326, 0.67390013383044334, -222.2564330208744, -71.457706487539213,
+    16.755034080707674, -31.872092898324091, -91.635278562316557, -10.26096677302553,
+    -88.119855923431331, -57.214480489828745, 57.066009032325951, 85.689966152530999,
+    13.057885484685755, -47.131084739895762, 3.3264882826759958, -127.51464346279595,
+    -101.43920357094203, 72.230935191005159, -26.674947505441324, -14.194933037364279,
+    57.171601663098585, 97.749964294432218, -22.491776173072509, -1.4052034352106944,
+    -186.465984111713, 6.6216251526647056, -21.367846014076576, 118.27008968327254,
+    125.98583269193904, 119.845923776989, 315.64610735225705, -19.096842157830224,
+    26.253061178083726, 181.59905966814631, 71.987837239122996, 42.300988719169993,
+    -55.624102784453186, -59.831106623130751, 23.984430724000759, -40.302255340306509,
+    -24.027228833610653, -50.685237676014935, -48.679759861338667, -66.170883355020237,
+    22.427445035097094, 1.6893787403100191, -6.9776793663751846, -61.727620946601739,
+    47.060254652141495, 18.656443132379039, -4.7624302866087191, 56.478377089198759,
+    -7.9882386633965723, -6.3419185641991191, 39.418973947306881, 16.161309861513928,
+    27.992815842145873, 15.219702208462607, -16.319915833732445, 20.626856708002506,
+    4.5360348583778887, -3.7012406887527192, 7.2382377401505096, -47.0120234145773,
+    -57.165097876433606, -2.3688498588552989, 49.774431415785664, -22.32035383062464,
+    -36.243095209225203, 122.36970772122824, 5.9924478260640432, -46.423965737580332,
+    -46.074929561001539, 92.518465313271292, 81.581775562284719, -75.611660973241754,
+    -13.764332973794723, -62.892932918466009, -24.661962294337741, 0.75292954239885512,
+    28.693622340115169, -48.522631133685479, -26.012535711759476, -78.657067556643256,
+    22.162657012709246, 94.156344193762337, -38.913996887888942, -118.96367595650275,
+    2.301643816478844, -68.072534073729798, 170.14090108137538, 15.90251139093335,
+    6.7813158540949416, -40.717345903864555, 12.273021282565253, -4.719676109699634,
+    85.710395757450684, -40.704260979215604, -12.793242836207895, 27.910887197396676,
+    27.173484822207961, 30.695781125800991, -72.834868931063596, -16.211529955041968,
+    -22.809078898736459, -24.350049703267008, 24.326105881492026, -185.611999705204,
+    35.973745586455948, 11.844785863612547, 16.393212945740586, 34.308698137598071,
+    174.7753094596473, 5.7565126394678998, 41.292087915495053, -39.290617222505134,
+    -180.29010009490446, -117.8852226054112, 141.34450405658424, -45.267501867143949,
+    -11.841727158284044, -2.5364658424734348, -7.1122053380509556, -25.95867989823482,
+    55.493586033551694, 60.872530563025151, -33.534148005788978, -86.446144192372401,
+    21.329447976160637, 57.176850406682632, -31.790772320031522, 1.4958087377038964,
+    -3.4329624475421952, -22.509834445248202, 20.892217795629591, 53.603997512921069,
+    223.29550703105036, 10.098534372705046, 25.063341169544817, 120.2759801901345,
+    -79.389968721673071, 32.574731585901169, 8.9060227623832873, 27.87072961537433,
+    47.773567416394883, 0.2784123860027421, -25.134543598373401, -0.26970838764192706,
+    -21.369477041349029, 64.050726392879852, 156.3768124064448, 11.947190237600566,
+    -8.0462184442014006, 20.051808483548314, 9.6842112841972039, 23.102045746287867,
+    -100.62081474014755, 27.139177170668916, -24.416085358393673, -45.248723915192784,
+    55.402621799291637, -10.085017518677944, -46.696732374737138, -37.936762582288807,
+    2.3151173606700297, -19.728904855484814, 124.46485705916881, 156.22989339951442,
+    -39.409477252864434, 11.504640280612307, 184.74110920889021, 122.99672099097758,
+    -137.02816842125117, -83.768494617196325, 8.1630051957416754, 13.370454766975627,
+    -52.529004864786273, -102.97328810776754, -4.63775746212184, 91.17534592878259,
+    -4.9793762460548123, 34.08090930182621, 33.326774177530126, 8.3171282818874346,
+    -36.357915577901984, 85.641986141603297, -34.141985984938707, 15.456953697692649,
+    -33.076539818928723, -23.037076384138967, -75.894931317507854, 1.0059278510863692,
+    216.73553364331508, 205.51737876641187, 4.8028266395473622, 37.624485151041874,
+    25.651428630896092, 52.017319467980499, -22.424968541043299, 7.291518194116577,
+    -65.064958893155577, 16.876333060772026, -77.861729633981241, -22.410320851378543,
+    47.098449716988718, -0.49917626309388652, -31.87915281140522, -13.018375122667331,
+    -4.2205195341471153, 54.977733037022176, 39.252320452083183, 22.444223189533886,
+    -39.944112951607167, 41.950768682934189, -48.227218210265086, 96.853619298058589,
+    147.50971678619987, -2.872095396521388, -50.038382918976922, -34.961734121552482,
+    -28.083286450302808, 18.585251474603005, 74.398688405672857, 77.682901884674095,
+    6.1458170054114873, -37.771880764901937, -60.243678652822155, -20.49394215854457,
+    34.404176261050907, -82.642805375737879, 39.55510124331397, 27.505247811957361,
+    134.87602200088682, -103.15119176090332, -157.10904472937887, 175.41198115306457,
+    -6.9169653605842996, 39.468177022704111, -42.099637796920888, -22.380183457794288,
+    -20.980907046701219, -61.748059303848507, -14.049040908021382, -16.721588331318287,
+    39.955971960531102, -94.147219088570722, 4.18912058022363, -77.052465901883465,
+    101.51687082151463, 50.206833590096451, -11.776459855162244, 15.649663009286655,
+    -10.066708528008093, 32.878037614172797, 11.644822049862128, 71.209229056619591,
+    -1.2700127300198574, -17.159994160472937, -56.642181082509552, 3.8156191727712212,
+    15.399045572365537, -3.6153312703954441, 18.96439712654724, -43.314990845096553,
+    19.042582121536157, -8.0935334038349538, -102.48983019910452, 29.316974626326996,
+    50.128099016037766, 86.057194261482451, -24.751829682242771, -11.252824085373163,
+    -55.935908246125024, 41.247988235173011, -36.076017941436277, -63.861975781434801,
+    -9.6058777903459713, 18.743008062958921, 36.248034031038877, 26.964425127923015,
+    -30.424455913192432, -49.699814961694919, 60.009472424272765, 19.408984902128964,
+    -29.592229185324896, 58.976374344361091, -30.50806475254047, -52.285782618275547,
+    6.6830330354883358, -32.816501219949764, 19.900425036186959, 54.254058452671416,
+    -9.406124836750692, -80.033286485199, 25.531734410699158, 40.669294873404986,
+    12.877422825212207, -15.065345750508612, -1.6167306715946097, -32.781235317492616,
+    74.821773037697952, 35.969723360889127, -142.55708056661811, 18.421850250348825,
+    6.0603214895612325, -11.9205446246728, 122.52744201817113, -3.1000689302349116,
+    26.221269007296698, 3.5006696801480075, 8.9619987814516833, 19.431013469351655,
+    7.6429684308580956, -37.067928709592238, 46.634011341296606, -69.201470968629565,
+    44.453288351453025, -25.271885884045062, 75.52146877632056, 6.5623359752011652,
+    51.438668750159046, 22.036615871538174, -99.457222039879426, 130.03717994334565,
+    -11.182205900647961, -239.66397112869305, -46.082438709521895, -93.873961056619265,
+    36.840759701312642, 130.34018928087056, 9.9016171331425937, 45.376434098745278,
+    -36.285837390997443, 11.893034351736105, -26.00162049246449, -10.339382286736353,
+    -126.1706702628108, -81.619048705200825, -4.3163162596657969, -5.8700909895200652,
+    -23.23285906689938, -9.700326907894862, -26.83140183821385, 11.614372939011389,
+    56.756875417977767, -101.38634160251526, -15.545903193573849, -119.49597863011138,
+    0.41320529910644432, -20.328297802380519, -55.065196270109666, -36.211976659956576,
+    -58.98904283060169, -113.3224166859184, -9.169051453390324, 3.0507922120431772,
+    45.591404715956074, -33.182707482984455, -79.374622944300597, 90.35296429926251,
+    -2.4108576735528686, -111.94707378862591, -53.709088171224721, -15.849636682877673,
+    -28.105044512961854, 5.4448294386195641, -25.476075710374545, -20.735139740810496,
+    -119.57975425199646, -131.67452433371139, -17.178138162395982, 61.347280621894789,
+    -48.069317315866833, -18.620017179882609, 54.235286247498863, -76.952145720400935,
+    -65.86517897348557, 25.60874806257857, 32.70401209170501, 51.529448950015478,
+    -30.340662827873189, 2.6761786585943028, 21.741787560273202, 22.666507229306262,
+    3.7976664106245153, 7.3973657163241349, -23.367422095085271, 3.2447279627342596,
+    -34.508705340137936, 19.896008218600741, 51.55681887930605, -50.898368199037805,
+    -6.3498769712450098, 43.228448219468817, 40.773200640655887, -25.508430713913071,
+    40.214760976442165, 5.1318752540136883, -64.246046911675904, -27.791938245108781,
+    -11.281580569073469, -30.181831472583497, -19.263885052143166, -18.743500232280184,
+    -31.961306487644322, 8.5786221157574687, 27.261024766299855, 4.9117052104131176,
+    15.376331299382118, 0.23934394785632662, -164.25498533564939, -68.318925832144203,
+    51.55352296483747, 10.92663758688704, 75.222294466965195, -15.521933222513496,
+    -38.433683046532806, -11.054921419415678, -34.807841680244309, 72.834179483377341,
+    51.424095652869454, 6.0758638656952826, -157.02676591844516, 15.870561873849283,
+    -13.540578317313702, -4.2592953276606469, -0.35160725041271235, 17.056373671281222,
+    -15.46932197285355, -7.6039088121507632, 41.808411820992575, 16.689814938489491,
+    82.639760204568404, 62.768536473092652, -25.20248750368512, -98.286773011583705,
+    -85.601644500896739, 90.381340820311706, 9.7782054037887747, 6.7650644881462085,
+    -3.6228374107012087, -77.555915343615098, -86.733954630964092, -58.469022688916375,
+    -59.690926144431359, 0.19786773666271529, -92.230022894736706, 0.58442520673216336,
+    128.15522055430642, -188.11303399194088, -95.911268308729689, -155.31045641722173,
+    43.754095695226965, -140.22093360996772, -51.737909029544348, 52.352496319940187,
+    -14.639268621984286, -7.725191513463642, -49.745218290197315, 33.922704186401774,
+    -77.87841775775756, -105.33351685598538, -73.849625387000188, 75.852622256409418,
+    75.843983111759357, 23.955885286208215, -40.630089618898339, 45.927024259351242,
+    -38.116080986750568, -88.055627036341335, -29.002410614661727, 1.7000016326197454,
+    -3.1860439733964654, -14.791095281953574, -41.424931010476442, -0.59970189752141323,
+    -9.3617893535953272, -117.31279551207327, -22.63705263365874, -74.63179137935002,
+    2.4547227439534822, 21.885806755344262, -26.083997415930501, -110.55305426714608,
+    43.42335262679137, 19.578769941545943, 13.074772544831234, -0.33488718416049323,
+    -52.337293351219756, 86.697371969709366, 20.198450726850609, -23.78837190153012,
+    -44.54366542758811, -96.420577236858165, -27.397644172271526, -2.7559237584203231,
+    -17.3955036388667, 41.331387595320393, -86.965246243521278, -129.16746239109514,
+    5.7821214370771941, -75.20004690657855, -96.146886957516131, -53.930506622198081,
+    2.9429163127496167, 76.363831725720445, 3.8923528739506628, -51.26423840805171,
+    -35.231040862385896, 128.46321776729701, -23.277748415845792, -53.440650019405972,
+    -72.588658163416184, 35.231071713417691, 26.143061534880076, -24.526837250814992,
+    17.580388923135345, -37.459715322325977, 98.904147139045577, 30.18875975380967,
+    199.34586176457452, 2.8856945613220688, -5.4553663197528408, 44.5329215488118,
+    -7.1098290424561768, 7.5572332701890446, -27.684073776338323, 23.021684768698478,
+    39.323832797734553, -18.685192393340056, 35.463168001375927, 4.0320717370652801,
+    29.928383520738123, 12.215478821156928, 83.023284167775401, -7.7345909278083553,
+    -2.6912132372962816, 73.588286826372808, 68.202668530626141, -26.432470548595742,
+    40.589892955655074, -47.655254954779778, -113.69347385974862, -118.48682831840259,
+    154.20015709154487, -132.20963711866582, 9.8207051718026435, 26.240703918408542,
+    -15.857645597832715, 41.180682865985261, 40.388604889252463, -10.033770199896651,
+    -0.051883495155607307, -22.472615469229208, 96.913742329789216, -85.663541111640896,
+    129.08398090460057, 58.600818558143516, -107.71310962004627, -52.235262562056981,
+    -66.12181334851833, 10.060758137903349, 39.424520726902784, 19.884771565261417,
+    -43.806157059998213, 143.95156960566902, 20.874149739224144, -58.39308620477243,
+    -38.447126419953221, 10.51688633276396, 186.1845130678287, 0.95439708389203304,
+    22.20840256907735, 61.476577403803134, -5.9409072786153061, -18.127235406368591,
+    118.57032627432795, -84.432306608976091, -38.581692755887886, 7.6193216720703418,
+    -7.1565255772788987, 23.434329610995778, 55.888271926497907, -22.816928129058766,
+    -3.1686108839088547, 124.74289872513134, 105.95307634479821, -12.713967775411263,
+    18.480262555491038, -19.238263314142387, -51.312511899983861, -19.271994818731628,
+    -75.235721470605171, -23.602280360030974, -52.280467684426874, 68.815937019975337,
+    459.99069781331849, -12.110936865378505, 24.201818674619801, -58.352745801041436,
+    -9.2529952929367312, 101.35128243298735, 62.122482222857684, -88.116967898139748,
+    -54.667687668731872, -61.957809018399928, 1.6977525373906677, 117.69418634914786,
+    -13.429047750232911, 94.674450828254024, 50.01187474016649, 18.887288614231011,
+    15.771352056822012, -22.355279432779895, -14.13719039103267, 49.775035836932489,
+    -70.88698749111748, 4.075862060372998, -58.415756447281439, -7.8372684329544313,
+    30.520951908010147, 8.1640828134683829, -46.540426494821901, 43.22587152287764,
+    -23.479633077196695, -132.8898279809404, -24.314705112751415, 5.8629519538290573,
+    13.982318367135662, -106.98353649280281, 6.3703728859052831, 78.100462617564489,
+    11.572759385350949, -51.413254568558486, 14.606247407876367, 5.9909720977205438,
+    -10.684464783802053, -29.056934537612193, -100.29873711194585, -21.292636016165233,
+    -23.429281942869039, -105.92551467330703, 4.1569585274878023, 58.578300366668209,
+    -11.965391044529724, 96.335277037024767, 10.473915725090194, 47.19143910827033,
+    -20.52149049648699, 35.647192224965615, 35.78565675867744, -27.082993149591985,
+    36.137560476108433, -78.632341523214308, -7.9640708474572932, 55.457104797413898,
+    1.8597740537254595, -65.780754922746809, 20.042954025825338, 62.246814664324887,
+    6.9415003243800797, 81.464957700505707, -15.385230990609472, 37.023781664408034,
+    74.694946360364497, -10.646917795213596, 7.4746729712023807, -12.606569087235812,
+    -15.24546379574835, -73.449064264711012, 6.4160062793687018, -21.881679860509529,
+    -20.301685333779908, 4.9001868982940664, -98.423590975494989, 47.740527961635465,
+    -37.142970430848983, 14.889140317780708, 6.6070443965338654, -81.373564360468876,
+    -1.3485908100833512, -2.0605499971894687, -2.530863918796797, -3.9029426482039882,
+    150.95228732981406, -4.0433812344726903, 1.6105537918138282, 39.86110535513663,
+    -36.602594874686957, 18.177996525490528, 29.945769121488979, -55.982169528398622,
+    -106.64320631418224, 40.575414411972204, 4.2154255023383094, 75.310159411482857,
+    2.3760188622485146, 14.516183949119991, -2.0703812654343778, 85.412957588288052,
+    9.7727775994598574, -156.47086405529126, 17.312401239951193, -2.0307878366335217,
+    -44.974486613632493, -83.763126066754694, -5.8268074956767748, 29.746667140214328,
+    -19.460642583926003, 17.723970331731923, -176.64456520612103, -14.483478405380481,
+    44.321652796199743, -22.707563225221975, 39.386985689023881, -2.9875822372340508,
+    -13.052954577192622, 71.262354198126445, 20.900201170256651, 13.983721992949754,
+    -3.2119188518399988, -4.0953798865275886, 83.16337623930086, 41.640465257062573,
+    -67.035856876043397, 14.698010457332884, -28.062550131982483, 33.358696164645323,
+    47.103653550337754, 10.971148874288559, -7.4002638885311249, 23.514399035279212,
+    7.3911743835410562, -19.9699761700316, -0.3676599655735231, -15.693692847116381,
+    9.260291148038462, 9.8753475039619474, 453.43382326944464, 101.44784317726999,
+    2.2987250088290239, 22.565972877901004, -37.072618800751052, -104.6374043461571,
+    101.99606020654257, -11.134466973670804, -21.531275183432797, 12.762540961904934,
+    33.088430431741706, -25.69186560882882, -64.435174990279094, -0.2496708638061591,
+    -32.542604102961732, -40.987633045301266, -63.65995653351618, 10.077012861192713,
+    -56.570770118936302, 69.43156211591014, -41.241755433326034, 19.017532346047382,
+    16.716665445972694, -11.685929876413923, 65.213507686778485, 37.457279754114282,
+    92.709583731517384, -88.815968862095616, 30.594477964048281, 166.80065466928411,
+    -14.872610621809656, -23.899155666447996, 4.8579439203577408, 157.6696262866509,
+    24.472735346348372, 13.328986768527216, -64.57610861892158, 80.509501417473558,
+    90.401258522647481, -14.679603805287229, 0.54610116427039657, -26.04976814127901,
+    -86.802857978898743, 12.98216266094882, -49.945174348563327, -17.998988835902708,
+    66.881829564324789, 6.8964279259383119, -26.253651642929697, -30.087300929810581,
+    13.100310672876674, 49.904714941611758, 9.055981343363257, -15.394130807106933,
+    26.676478033588069, -10.438372149116546, -5.4928397946281962, -9.2195289112645842,
+    45.547144663628764, -20.856832593541384, -4.6992638908390063, -38.742349167585814,
+    -81.806066773477909, 173.4816901414838, -18.136623398321071, -12.292485354516877,
+    7.1545929859815853, 5.5014943826967055, -174.76623893982412, -26.065633472386324,
+    -29.792686241256604, -55.076659879411011, -82.463256524640727, 34.445131258427189,
+    -17.178791752990936, -30.516090207465083, -12.206565717992753, 49.812133534923305,
+    56.088434775233225, 37.461561748051281, 25.479779993915709, -0.29821804348750902,
+    22.349312514383399, 94.893580397910426, 35.260277039773946, 43.746803768644497,
+    -64.532608514728523, 29.921849454715229, 16.569043933273782, -79.632869847472122,
+    1.1665131667476203, -26.587597752479724, 73.52578988286723, 99.754675331676992,
+    -12.160063396729868, -23.894142133022825, -0.27821848015466344, 138.06363818571421,
+    -41.171768696087582, 43.383289290877819, 214.09800647360248, 41.070195481156276,
+    15.534398507004525, -5.5653349076293921, -6.2215942203262671, 27.671303548604527,
+    49.156616556101753, -6.3041655082507759, -29.450279472472587, -14.456714785601292,
+    42.819921513248929, -11.200027851343066, 38.17306959152998, -48.483080144798635,
+    -13.009392159777235, 19.734475944706105, 18.741825674271752, 27.971964084065661,
+    -74.657798870649117, 39.148742841716398, -33.690288004538282, -37.590276129144911,
+    56.515320927071357, 8.4853410082031218, 79.638884108580214, -73.918152196935836,
+    4.8692021542277644, 1.054385841679732, -31.210449966037544, 8.4595538036512608,
+    43.596756476627405, -62.498701936876586, 41.198741461801049, 8.4712185038823975,
+    -17.138258967413265, 60.307295374102871, -3.78817977499655, 12.898218796940171,
+    38.676506917670395, -10.749857620164846, -32.686475186558859, 60.939560060002883,
+    48.536182726448303, 76.59397134781392, -19.797849854337741, 35.055518693184197,
+    -43.078749086045448, -12.606093122884715, 78.599863502891139, -46.114102605060566,
+    30.124777033966431, 5.3436989683767564, -43.996628295409991, -8.5614416368971433,
+    -60.112665934496917, 16.507993850427027, -4.0073059239759878, 35.202970023637533,
+    28.504877688536595, -10.5687585438003, -8.8990109726686057, 66.925599080245661,
+    -96.378803521517511, 21.486308104061237, -0.90107294913752867, -143.19630571538596,
+    -68.668238704909697, 67.166385665323858, 52.680297368563004, -25.215968274102558,
+    25.753688092783975, -37.019237649888169, -29.826072823844058, 7.5492213670832022,
+    230.87225303951473, 6.9111215902113372, -0.41016471248065045, -47.859225937957646,
+    -32.347084499797575, 53.125512165500524, 29.767289802892762, -10.705237179351798,
+    59.342441888941039, 135.18898157724675, 18.73479170522662, -131.71695485683193,
+    21.641088005089728, -88.454088561516812, -24.021674912976891, -29.584297336975567,
+    -39.058751947060344, -7.1264615105462781, -28.512584871207935, -167.32637677336027,
+    0.54726066689594077, -43.334175227507174, -109.42144368147233, 5.5520631502374727,
+    35.351478823427598, 30.056125106021085, 88.49675246989068, 37.555405289260932,
+    48.92177402937466, 13.903233372915594, 4.1815388827677964, -94.278513156739223,
+    -31.867083938399418, 1.5643525347139757, 78.248092471546656, 124.87684107248263,
+    -44.910157997164902, -33.998201882223043, 18.690706731507362, 6.850841014792536,
+    -111.75978988501531, 129.82843826126731, 3.0832643282155772, 59.130782637230851,
+    11.599122585378609, 89.293667817847791, -33.863577454874573, -17.334098120918345,
+    -57.069913736658954, 9.0950154885551981, -10.48858364593908, 10.630865759374734,
+    -5.9876898300508401, 11.163057349475466, 26.066379606948885, -29.765542189628775,
+    48.857647773694282, -82.369663061570478, 61.909393739030733, -55.892739461140891,
+    -500.7268999821186, -127.41731455711627, 183.06881670380855, -325.85883232134682,
+    -208.68825501538211, 53.590274271791131, -200.64762220622089, -4.5111810788998081,
+    -132.22390561404799, 108.93729891017135, 548.46625760840038, -253.80127296367786,
+    -245.49790644223634, 122.15557329536338, -76.649063442731972, 32.632056214279004,
+    1247.0488225147797, -133.19789425050089, 148.26172662624697, -85.384154634875898,
+    -278.24651480353373, 146.5037563793515, -37.614862292283895, 33.603579050808094,
+    -1729.367198284378, -156.82977640995176, 71.127473207891171, -40.054815034022653,
+    -3392.1227991136911, -80.234446013669469, -103.82920231899796, -30.203342036805164,
+    -8.8721494976116873, -147.22328982618021, -1467.8500182020732, 15.744006449238668,
+    -125.61962492996878, 161.96822128364153, 308.50823552728582, -28.29322089638632,
+    171.23028912215227, -31.057986824847355, -74.085719061887687, 432.00522593166852,
+    155.46101873746397, -41.991946031189528, 13.74501772395163, 98.319477978725004,
+    -191.06462476212963, 113.10788716287063, -111.53816968049482, -694.88312980216597,
+    -264.07705953288377, 122.03289244233099, 206.19580361262322, 744.846078658397,
+    -13.434675709375203, -103.47330791314067, -30.941201231546273, -28.576460283736083,
+    -170.04701861607484, -354.51718245584306, -518.89270477590014, -5.5344386253194733,
+    -122.37471989825599, 431.00403739710168, -524.25828316561922, -92.213579637513078,
+    -306.73448118841321, 179.4076484316551, 366.21634349355071, -108.89670145833435,
+    -2171.0162820958212, 165.16556950942021, -47.363118173952728, -24.529798554687968,
+    3268.3393512141665, 13.786775309973024, 184.79835367029068, -1.0668104202418702,
+    228.54543448739304, -73.260650725429045, -241.5807656469301, -30.6300284994647,
+    1840.3959343370866, -79.496029439230966, 55.45070509110451, -151.73949331546254,
+    -417.94598052379911, -7.7224234156789038, -511.73568956728388, -124.21730595641928,
+    -15.305384282015288, -420.82558690296554, -85.485739351378456, 247.8244836681169,
+    -635.24138702287166, 507.62205952668614, 269.4233776584781, -136.67217533289315,
+    -935.8668790275326, -112.45558355340557, -222.77924102529255, 29.583058268169992,
+    -533.97863083491472, 82.143612262314377, 2076.5150778707634, -242.45401672277296,
+    -733.39279572850273, 469.02191806396507, 253.50036483821629, -412.33944044875352,
+    50.730883492726463, 74.420638068973915, -228.32123543100417, 39.787096165049604,
+    -233.19032040980099, -154.20903165936321, 1779.7464554624926, 318.35987282797339,
+    -82.310590697210984, 58.186890813405718, 253.15212563195072, 62.297355045353811,
+    -646.98079622831608, 5.3028535196616735, -56.267562254168652, -78.481610066914541,
+    -818.8262380095822, 50.588714833957198, 712.71315820100426, -105.75062674421159,
+    -4.9363013164067695, -108.51321118179021, 516.36502472917107, 31.185611110879389,
+    318.2980375823401, -165.54421004521924, -2502.2665484044696, -4.0721273871982362,
+    -283.93184317904792, 233.25095433982639, -516.50936527473925, 176.79663902573563,
+    313.79250948411203, 156.122459878977, 2183.7722118499578, -243.99537047927703,
+    131.18707693945257, -26.10038461729139, -146.35682931498152, -24.711478372989674,
+    71.247663179760366, -63.374329208629092, -653.24432295083284, -190.26739516744533,
+    -411.05344713812599, 59.698500715325721, -748.33361783152623, -136.52264338233195,
+    -332.43455573332835, -86.269460262998365, 99.683658060861603, 61.359572032532057,
+    -211.95594043471718, -41.730563986300204, 304.73836980537521, -68.702660001456479,
+    289.21774339488331, -823.75554752016444, 1277.6261891405427, 158.09893235065906,
+    -2844.2399083477635, -89.365019872321199, -39.289808836672819, -35.288054268077332,
+    -213.54745762547356, -76.330516305512703, -337.23747837546938, -24.362383483873494,
+    -723.1323875380715, 167.17243805020874, 1755.2208665653582, -15.112349510285336,
+    54.084400941072275, -450.04044686646193, -1616.6131410970806, 2602.3048501570429,
+    668.24572424302039, 35.966571410074053, 1058.6216315245861, -131.5223504884876,
+    24.156239727020747, -327.25198218478261, -115.41976961712382, 15.447918921128689,
+    286.28619886122772, 37.993324430159703, 284.1836009908061, 663.79426587160435,
+    182.50904988146141, 14.615328281829202, -579.64672097708603, 64.673624234188793,
+    -804.02939091543828, 78.887290998939648, -24.860680853852443, 68.350460571936964,
+    402.69940962482457, -112.46340541164699, 959.36222362770957, 773.97068089620359,
+    -68.144523330464764, 438.2054902309182, 1488.0724088874335, -226.0755036894092,
+    39.731648805220971, 38.806852298028481, 821.92539232361821, 142.09800217509033,
+    228.18905642111358, 196.50922569924103, 14.76331530062035, -14.354941383401028,
+    -431.87160218933394, -128.81511904278045, -1966.8864305958507, 107.88851600202496,
+    -5337.8918951729847, -570.8032128756081, 2058.5653665904661, 599.85329463512312,
+    -38.80045339816558, 19.195473842781517, 118.83605808038817, -244.86784282196948,
+    -1180.0834507685863, -1.244896070058346, 450.95178218577132, -126.88662653302839,
+    1876.762893199628, 120.37728381266521, -1017.6845321750396, 7.2504803362049355,
+    -446.36741294318227, -380.21735764685224, -528.89666704127603, -241.82069740002748,
+    -328.46024294117461, 13.544269196991058, 1417.5226071056545, -21.457111092659201,
+    579.76136753776746, 201.89672187647659, -836.06993067321616, 1041.111959263073,
+    342.12007822597189, 128.25982869890098, -488.14684050686833, 20.563193043497449,
+    -680.4191284236947, 181.61938787837198, 894.35621099390642, -240.08149063359852,
+    735.04558306936894, 158.2873528364081, 125.68908293784841, -11.368016878203854,
+    -357.84180662283757, -20.413017099834157, -98.354077172329013, 98.409030656090522,
+    247.29433069719269, 13.29370134083355, -500.81890268746633, -67.861205582464038,
+    917.74559346979936, 21.44192030273183, -41.868793742982639, -17.750552379351234,
+    6.1520277948721969, 739.07409256782955, -449.42952631594534, 22.150092931519755,
+    294.13945308170042, 415.63995964346145, 187.71973799332289, 290.39635236921936,
+    -287.40491119667388, -493.90618946807626, 1332.4879411078095, 90.365191810354418,
+    -18.297991237280741, 6334.2634623311878, -294.60671917387782, -37.151702360552207,
+    -593.70531009490526, -33.036755703545261, -971.12992289415229, 4771.1974905714242,
+    -316.16535602575436, -142.55607629824269, 457.63859784949869, -27.537323163735955,
+    -970.87301507222992, 367.98453513037634, -181.90843071193711, -106.32278797068876,
+    336.82775502882816, -2.8819332288130455, 69.707900469420338, -44.370732189097112,
+    135.21872961225193, -39.800144163441246, -78.050077781039818, -369.56668555520355,
+    -300.58229408512574, -25.666149543962135, 334.05673206209758, 34.654199240455782,
+    -1094.0345150533994, 306.4346373890811, -851.52868759708986, -11.750010325252417,
+    -3150.7041437679641, -169.50740717608957, -421.57013787249042, -77.753979046692876,
+    562.81334939362819, 156.24902381947902, -418.80833327298848, 115.65283336180886,
+    336.08380817596299, -117.3058048919614, -195.01668560124546, -129.43071627980643,
+    -534.87089527193871, -12.714712337027134, 296.71770604429821, 58.073092731352759,
+    671.34459865422048, -155.60896515275275, 230.31237885036666, -207.83691927797017,
+    186.61819230337787, -274.60455618505961, -38.04318747338516, 49.629548748974429,
+    -397.04130282641842, -61.363279309652839, 3745.8429760132431, 1.6427373492851571,
+    149.22185196581279, -289.57514764400435, 100.60359406689268, -171.93983595140847,
+    -764.87123969856736, -729.27631972320444, -659.38826065669411, -785.92224188395289,
+    -52.342735531206017, -577.12810488879347, -18.230826609379736, 11.415695229485721,
+    -57.524564493960611, -256.92279876116049, 598.44873696733055, 7.6143640479955783,
+    -996.19339957608634, -203.96531217219854, -48.017293772296668, 308.07457403611954,
+    163.09374748156969, 79.33511112738924, -99.522352676159059, 249.74787236655473,
+    152.03633177931735, 42.832626009100053, -116.44985132628508, -230.9538600559697,
+    -35.883577531409053, -217.23580202428747, 420.48253182218298, 222.88277252231791,
+    -192.15572596080304, 209.02715994822722, 83.488490538843138, -49.374906083192094,
+    -724.78718561711344, 55.217785958250204, 428.2842007594204, -176.60518695233873,
+    1182.871362316826, 93.371154443698742, -334.12544510338398, 6.9016393140197501,
+    187.01680002921, -297.63864977403648, 490.8374416568123, 61.940368823532893,
+    -717.34308405827107, 62.461204050228673, -312.40540534425912, 83.210317473929166,
+    700.81540267775097, -10.617531806221962, -875.23159304493163, -111.38377698120775,
+    575.31193698371942, 49.695515785844734, 296.30444275134835, -122.8175232123026,
+    568.40280100644566, -66.642705433762885, 537.7629578355893, 164.40260444711885,
+    -163.28324940399847, -142.46589616795939, 24.430823123821099, -224.92681591681963,
+    3291.5166787027883, -296.2037266157368, -57.236217536024071, -122.68255784000823,
+    -1169.8339018748227, 163.82196391428025, 77.454545657211256, 123.91317042295994,
+    75.559056036419562, 59.514740997974307, 776.16304882200325, 585.5631824214737,
+    -118.42528225397217, 309.74543281039706, -534.90475813685009, 1004.7149441677533,
+    -149.05271786231907, -693.83146616052704, -148.09783023781605, 70.729161243629108,
+    566.93717106052873, -24.016295360858624, 23.434250116686204, 68.812762213613425,
+    116.59494853149062, -49.219137005260102, 818.37199304495402, -10.572454241714953,
+    -1925.7216647749867, -184.53764746365187, -213.62762597911768, -109.0313492021058,
+    -33.511681908233598, -145.05475864093029, 2642.1786973394037, 67.891611881333361,
+    -709.24752757891429, -266.9583238439451, 645.63579726309877, 141.39111630318519,
+    -299.18254932396087, -6.0360850084931039, 589.44176328528567, -0.25015455376319551,
+    1265.0703389160565, -10.059995618590136, -12.589192403702683, 73.054972447840584,
+    -85.250314553558368, -122.75645075270236, 89.726317104871143, 222.94902053289894,
+    -130.27458887297166, -20.002331692525146, 348.02716861072116, -507.79999389126084,
+    -1092.216534105821, 486.63113716821869, 590.423132571412, 31.292811191781023,
+    1836.8273957592044, 328.17860575490943, -1251.9051253682783, 159.30381155645404,
+    147.12829279090991, -229.07964291192025, -581.3498343250867, -24.317227371942398,
+    -407.28264719815172, 31.891436152847803, 955.62232036194155, 167.53045251421838,
+    1471.5570396722946, 133.2295987481219, 514.38019269192932, -9.2644050863653753,
+    -934.43377472961856, -25.73794487956194, 226.61213638665902, -5.5094560979252103,
+};
+
+static const double REFERENCE_MTW[] = {
+    80.379999999999995, 58.024506280282331, 3.7724259313415001, 28.996124047292291,
+    49.22389487028704, 24.602838166429851, 80.380000000000038, 75.996898217476016,
+    12.476952289801863, 24.730101752749508, 71.14706667877725, 80.379999999999995,
+    12.861749636269208, 64.923722175689818, 80.379999999999995, 76.64959712785641,
+    54.14117802850722, 56.45319168476567, 76.667871168624515, 63.696510086004388,
+    47.303968884251887, 80.38000000000001, 19.238334623370204, 70.125846333590175,
+    80.38000000000001, 6.4198663953956032, 80.380000000000052, 64.720406580526145,
+    18.001200012048407, 80.379999999999995, 78.618383613235039, 39.902043279143292,
+    64.519372727281521, 80.379999999999924, 80.379999999999995, 27.840018050437848,
+    64.119377876104863, 73.082036950516112, 1.7200090511499566, 17.836381889200904,
+    31.737450776212896, 75.850790984198923, 13.116112101132272, 61.02370947899783,
+    68.658108804166233, 42.408750390383382, 73.600838410754207, 80.379999999999995,
+    34.476718736864143, 36.923076916943657, 49.062197360506175, 53.273409060521921,
+    65.918087523481887, 23.666524460715515, 59.896307520134009, 29.604516194884372,
+    78.074527456138298, 80.379999999999995, 44.209910833660921, 30.313691785731582,
+    55.239046398970864, 50.777717954878277, 14.974311268437287, 46.547104274368628,
+    16.264818673435855, 12.571786879033359, 46.747262618131138, 62.332171171967921,
+    63.548030735343197, 54.172096467488103, 46.598573465884535, 78.344978650723391,
+    80.379999999999981, 1.826934173580554, 8.8917988562349493, 21.971397207364792,
+    49.112090762851857, 27.018322324952056, 59.154911403376573, 49.090455785356625,
+    73.895528198894652, 59.909386374226976, 23.73591628200932, 0.73102364777368356,
+    46.191579127918601, 43.821773426022197, 46.221526303963152, 48.478265134710853,
+    8.3311227392437264, 2.4283766641428013, 67.715488811308433, 26.876752033392783,
+    66.064062413146914, 59.883180226953669, 77.555529148787059, 64.644827541725135,
+    80.38000000000001, 80.379999999999995, 37.604254368618896, 40.628432223534716,
+    23.318015822989146, 80.379999999999995, 21.215576750845592, 57.604350327897926,
+    70.661313263823558, 6.1582744283897268, 57.342660178475796, 50.365595265593655,
+    2.6379865229867097, 22.44224766744118, 54.368676697160225, 64.772502864994706,
+    80.380000000000095, 14.490764893117506, 35.407611907986407, 32.963113426064808,
+    27.635068605760473, 80.379999999999981, 57.79315562131999, 60.379539476883075,
+    42.077442344014415, 80.379999999999839, 11.380127634014489, 4.2543316121402261,
+    78.286925382142357, 58.680177843016025, 69.520018857991147, 17.269501919461366,
+    38.220326945833456, 47.122637358486827, 19.374540253650011, 79.264566049154197,
+    43.931673223790604, 62.088311598854787, 80.38000000000001, 20.445687718426239,
+    54.298953836067248, 53.779331586919369, 80.379999999999995, 80.380000000000791,
+    25.573138315312626, 33.191859054699414, 73.645791042250508, 16.77458045142227,
+    35.537049418506761, 45.345957305351433, 13.467919531357616, 40.036305974505176,
+    80.38000000000001, 80.379999999999981, 80.379999999999995, 41.718180177363266,
+    80.379999999999995, 80.380000000000024, 80.379999999999995, 40.856054019445168,
+    40.659062066167365, 80.379999999999995, 51.344062185736824, 47.029101683793805,
+    53.359283868334344, 80.379999999966785, 29.060373099500232, 75.285292616579156,
+    27.383777288042374, 22.236774547202316, 59.63804438440242, 4.8081116101085808,
+    0.26331780078462413, 32.990074898028283, 70.800285755928371, 74.996154520763724,
+    80.379999999999995, 37.191609604899803, 74.696845181151588, 80.379999999999995,
+    49.188042427975759, 80.379999999999995, 80.379999999999981, 19.120120095892272,
+    40.302478934728398, 14.598451312626935, 30.497704784348755, 73.053701530852337,
+    60.765412410159833, 46.2961409736711, 32.390793131009772, 43.442075414750853,
+    70.386950176695279, 38.828938684719631, 56.233082075581272, 40.738710178953028,
+    39.762548844293008, 2.4750759399192206, 51.67702521663491, 12.728714989643537,
+    22.886519815418037, 80.379999999999995, 30.316643829719741, 33.375974516734679,
+    60.271182928512431, 34.766376549214598, 13.446657079633079, 13.061804735572885,
+    4.8050770997411334, 14.047657899895169, 38.282371088416177, 58.903512015041819,
+    53.339825006516527, 80.379999999999995, 37.724092739443179, 80.379999999999995,
+    30.665298575893694, 13.073053436118958, 64.220411277450665, 63.035751643115567,
+    40.651384609906344, 57.012484713360145, 77.799204171984144, 20.430764499582303,
+    80.379999999999981, 62.365577996846021, 0.71656726627962242, 27.68811095002285,
+    80.379999999999995, 45.080296965732494, 48.762585759974293, 44.25927033920911,
+    80.379999999999995, 72.869619347624081, 5.0226301890260139, 53.240291330915113,
+    80.379999999999995, 34.004109351550653, 28.7127289207763, 80.380000000000081,
+    22.221942927431581, 68.036778396121974, 25.904569432348506, 26.061263602897487,
+    80.379999999999995, 54.182416656529483, 19.753855445993455, 63.584035516869093,
+    9.0981820672527771, 38.632773121119364, 10.941514157813481, 80.379999999999995,
+    9.9475254487520015, 7.679892793406073, 73.058883411921784, 41.193646096405367,
+    12.248814816962948, 62.526502319523956, 43.36841175307773, 17.509848997633995,
+    19.902343044435071, 40.932763964502975, 12.099087265882869, 53.876623540125294,
+    21.101852074872145, 55.019747690163662, 48.771774151886397, 80.379999999999995,
+    80.379999999999995, 40.203466722893644, 28.045021569160951, 49.614288230686739,
+    25.215307353297955, 80.379999999999981, 52.977431885177751, 57.389485303411931,
+    80.380000000000038, 33.234885994547241, 4.2068505763984057, 40.23751190141423,
+    66.32080946806515, 39.673892104300464, 65.630972082380183, 13.54789922076475,
+    65.966919557348717, 80.380000000168337, 28.24619709319855, 18.51501064907341,
+    35.74082160605068, 59.479948031459713, 32.032270619589546, 80.379999999999995,
+    51.334730300382894, 12.559607596217031, 18.542158778064856, 73.352159382135611,
+    78.933674271278861, 44.410683025873062, 70.930436250041581, 80.380000000000024,
+    15.215420031733682, 80.379999999999981, 21.210471040634925, 6.4862936045476083,
+    3.3925734553667182, 53.464601651894569, 80.379999999999981, 73.370804046981462,
+    39.753043320081069, 31.034556410238103, 80.379999999999995, 14.072144800014216,
+    22.783436887467573, 38.01966348651753, 16.913713021221344, 80.379999999999995,
+    80.379999999999995, 0.28741340508409097, 48.644421255216905, 80.379999999999995,
+    80.37999999999991, 11.304442533827654, 25.489508295594909, 14.862467819889869,
+    70.681431802332654, 80.38000000000001, 49.93921584898834, 10.86586729602989,
+    6.2494733219750742, 52.326418311894507, 80.379999999999967, 53.75686132119516,
+    36.973118235419001, 14.862536134321262, 68.11239104552773, 80.379999999999995,
+    80.379999999999995, 70.960342855001272, 39.276148236991091, 42.08979104361616,
+    36.353539744740196, 23.936482608344111, 80.379999999999953, 5.9650852035985862,
+    1.4366588797346804, 45.264260524929398, 35.149794935505724, 7.5314007471326994,
+    72.632395717442606, 80.379999999996016, 45.925592926829239, 80.379999999999995,
+    17.488790758119059, 27.531779250711089, 80.38000000000001, 18.285081822285104,
+    3.1180238815683734, 51.085662498474228, 77.744720873209616, 47.520994040677373,
+    1.5960099905799559, 24.921958560020006, 80.379999999999981, 8.4231005613970975,
+    13.616478312298181, 68.460033387905725, 60.130354416035942, 63.112555994878605,
+    19.128153599579917, 69.112951175313071, 57.868551531005849, 80.379999999999995,
+    17.966390468814289, 50.064598172473652, 30.502532533606662, 25.897863762566924,
+    80.379999999999995, 63.351131698465778, 80.379999999999995, 78.809977559122771,
+    80.379999999999995, 80.379999999999981, 20.04965367928132, 68.061814293379896,
+    20.703670605030311, 12.925451124698705, 80.379999999999995, 80.379999999999995,
+    11.545672417677386, 14.444270667584464, 80.379999999999939, 38.999946604905944,
+    80.379999999999995, 47.293280523909651, 13.278256181145657, 80.379999999999995,
+    49.92535118860895, 46.442362809524234, 40.761915936806638, 80.379999999999967,
+    80.379999999999882, 39.954791194941208, 46.470941763388446, 4.9785601481778095,
+    80.379999999999995, 21.548104026317745, 80.379999999999995, 18.282301795804166,
+    80.379999999999995, 18.087147261386882, 10.755007719181279, 22.307775781664731,
+    72.763948029136714, 15.317220865723781, 9.7185823446625843, 1.3762066149641434,
+    47.610936338837142, 52.273379525696775, 33.401247229090778, 71.45732817881796,
+    80.379999999999939, 67.555805908253902, 80.379999999999981, 80.379999999999995,
+    53.423993616739381, 25.197277332772945, 43.234168829712203, 37.300330616821775,
+    5.1799499580236636, 10.671540216628253, 39.057679062345606, 51.488359753084907,
+    21.941285103300828, 64.576099957102869, 63.540024245672925, 16.389214559463898,
+    80.380000000143809, 73.244039657212952, 31.308516973097706, 3.3534064615328312,
+    29.048620345622204, 36.25191640759126, 22.199977600794512, 80.379999999999995,
+    28.907750070095865, 14.901686168756083, 51.160191028495326, 63.792050027529918,
+    50.470521020205894, 80.380000000012615, 51.311814778886493, 80.379999999999995,
+    4.3795411373778217, 80.379999999999995, 40.950520877201534, 28.577608252043593,
+    54.152966900368789, 80.379999999999995, 77.768640829032236, 80.380000000000095,
+    70.01229885870751, 0.85751608820586167, 42.170289136389407, 55.459741328779948,
+    18.854645877751608, 26.984075148214494, 80.379999999999995, 72.681046136767165,
+    7.6674714310790728, 36.555494064162161, 80.379999999999995, 65.518882285245581,
+    42.526428054508564, 27.216887726881492, 80.379999999999995, 41.037391756438709,
+    80.379999999999995, 46.358412784269582, 8.4375508439708877, 64.556403422198414,
+    14.422695377514753, 80.379999999999995, 57.424417268721342, 55.009629718481214,
+    20.141542818208666, 77.904643391418062, 8.7336329730196915, 80.379999999999995,
+    26.830084632149617, 53.602427881771106, 37.938744146489398, 72.963847841570043,
+    58.963352687716878, 17.562836556394554, 4.2376221472565732, 67.610154664170281,
+    38.099307377988346, 70.201530230576054, 27.738577481394771, 52.277450512270526,
+    65.766081061376326, 45.695712663164095, 26.410781926552303, 62.461792513501244,
+    44.819210027763503, 21.457790758849356, 52.629120935370459, 46.699747539009785,
+    70.563996250191778, 23.243942388803571, 51.985632310142307, 63.363605218672902,
+    19.305907803782794, 80.380000000000038, 69.91880092590236, 62.616738555677784,
+    80.379999999999995, 75.440549752642553, 55.021264164505361, 80.379999999999995,
+    1.5796070934173159, 14.743972998857137, 80.379999999999995, 56.87022700851383,
+    3.2851076631741609, 0.5123968057614301, 62.779008513535082, 25.283773606257196,
+    10.808607053204513, 80.380000000000067, 67.178666853764355, 66.369623876821422,
+    25.46371965560532, 7.5133946099180768, 43.015543574921807, 55.557003122257626,
+    17.451314074660921, 24.380109628972544, 16.59491123788192, 20.492214589109125,
+    80.379999999999995, 31.424168193305551, 30.118322967241014, 12.193545661991063,
+    8.5499284627919891, 19.091401858494894, 70.721737515307979, 48.137802811281531,
+    11.715632031684287, 59.382205545361963, 17.843739726258868, 50.461227235265817,
+    45.866439447453281, 53.319380551820082, 23.232793337859963, 33.434288124493889,
+    12.116286946766685, 80.379999999999953, 72.590600559391021, 12.598375577067387,
+    80.379999999999981, 80.380000000000337, 67.776055102145307, 22.579616735293627,
+    7.0246819124115989, 14.605981830048394, 80.380000000000351, 13.489359634939575,
+    18.480430663239858, 43.431609000979194, 68.952294358778502, 67.298502776285673,
+    29.333557901098366, 17.823080970763442, 36.747788790033574, 17.024448733605663,
+    71.572553741648193, 80.380000000000081, 37.278478601362764, 0.9755788812800954,
+    76.584183944188524, 38.718451884622866, 40.149204685149016, 9.3203233915571335,
+    80.379999999999995, 54.307033054123046, 77.790101934392524, 41.307948224560704,
+    52.253820904090723, 74.169268674694123, 32.028087077360333, 74.932373847219992,
+    56.509488455771177, 80.379999999999995, 7.7820477174540708, 49.118228039597497,
+    80.38000000000001, 27.615083390649467, 24.978320742926009, 56.13363751876188,
+    49.937218581429107, 80.380000005306599, 8.4223141865448365, 80.379999999999953,
+    80.379999999999995, 57.901467424225451, 41.101218107917376, 68.564809960428803,
+    44.411536046886695, 80.379999999999995, 14.044556504407122, 25.450762584298786,
+    48.859020814687469, 80.379999999999995, 20.245240198705861, 8.9445517027692922,
+    78.820172249830136, 52.994233993713522, 36.086790088538685, 16.899690726840156,
+    46.667722203143342, 36.995444465827305, 50.312563734985851, 78.653629933337939,
+    80.38000000000001, 40.349776588282715, 43.580717608378897, 22.570401735288847,
+    80.379999999999995, 80.379999999999981, 34.832269562528516, 48.643700564265927,
+    50.349472860838965, 14.426814006427124, 50.283537782254747, 80.379999999999995,
+    80.379999999999995, 40.30523517616335, 55.606763617733435, 80.379999999999995,
+    16.606108215063749, 75.296881441930708, 61.767137998118628, 49.126237314238928,
+    37.444100234290104, 13.925874553746143, 46.236906074436966, 66.92593237485282,
+    80.379999999999995, 20.402803016023238, 63.017128538389294, 64.188296658348492,
+    24.573297518637254, 13.605818383116775, 28.274144928524446, 65.578568378248534,
+    21.080298738922671, 12.160075825203682, 64.26116615446378, 34.369427712683155,
+    72.566726827949708, 41.456044811724304, 26.352580826725656, 56.984687066551459,
+    38.091707740130659, 66.146311330491784, 36.671192668829512, 28.952134689655818,
+    23.750818231459192, 60.757918568478338, 80.379999999999981, 66.781680082150856,
+    80.38000000000001, 70.727550036563542, 2.7111518516152411, 38.401796576200312,
+    72.437541032708836, 39.618794557522989, 76.229255811247853, 69.023329208741771,
+    80.380000000000024, 80.379999999997608, 62.385619042271038, 36.795918309516807,
+    36.499049094357048, 28.601136814378805, 80.379999999999995, 50.992241053772347,
+    74.334373600206348, 80.379999999999995, 78.948993995786125, 80.379999999999995,
+    37.666989706369115, 80.379999999999995, 3.4368797848652473, 47.848927285147468,
+    27.267546079476627, 56.635871734985564, 72.99668109527461, 45.255485129729294,
+    80.379999999999995, 36.818206151500554, 37.116204279207288, 39.692703438337034,
+    58.910509940955428, 38.704251069849761, 55.913699685222078, 29.471050240430365,
+    34.588426161391411, 2.4662100415823529, 44.451273051704064, 4.379632188277446,
+    51.402690144791883, 28.394154214497071, 80.379999999999995, 32.385110380284473,
+    36.797147306250032, 13.151542533794606, 80.380000000000024, 54.98844855958167,
+    25.331488761162632, 62.223475594391893, 41.099094438541243, 2.127344566390772,
+    27.710702700759349, 65.317961652311951, 58.157144042195277, 47.312500163565915,
+    15.236715492823656, 12.879439728229915, 60.127033874704871, 62.469759373317842,
+    26.841739082507281, 20.203086468864402, 43.052458893778152, 10.785047727770346,
+    30.731853255040694, 19.908229289454962, 0.53426590282394637, 38.592429267852602,
+    13.183429887684483, 54.9485693344662, 80.380000000000024, 49.586386424150469,
+    42.246472123570641, 71.255325115077383, 80.380000000000024, 74.21296065509344,
+    14.302098913236547, 12.874066472815056, 39.889851124799591, 76.81471479492491,
+    59.409882461984957, 69.800472029557952, 37.454499778616615, 80.379999999999924,
+    5.0549679047978655, 80.379999999999995, 55.932976849319587, 76.684724635802738,
+    34.124585025380171, 68.552548894971835, 31.980411406115376, 51.624914928264019,
+    80.379999999998589, 51.284734957109045, 80.37999999999991, 48.799726286627852,
+    31.244086962366524, 54.626574068453913, 80.380000000000024, 21.359843361803208,
+    61.389481037363154, 66.523553214399172, 26.401056786762286, 74.79789480347938,
+    80.380000000000052, 51.037753621422624, 80.379999999999995, 41.999401316168644,
+    80.379999999999995, 40.982263889227916, 43.90832315925973, 80.38000000000001,
+    14.793767294523995, 67.10643264563528, 36.967850931781854, 80.379999999999939,
+    7.2232415720026601, 69.504075092577708, 80.379999999999995, 67.368324083171359,
+    26.287875859002014, 62.687063848876328, 1.0634847365590769, 27.232865584296242,
+    24.579070074176812, 80.379999999999896, 80.379999999999995, 68.083733861857752,
+    77.055952773856262, 73.935678939321221, 4.6064415157219223, 51.722475961631218,
+    2.7254828776958773, 14.570054441124524, 80.379999999999995, 68.512744688163323,
+    80.379999999999995, 56.0975232866707, 2.6513687002005177, 36.297011993604158,
+    18.968852369671687, 31.19209718688856, 42.361187909396925, 67.095807802350123,
+    41.676621832988545, 69.60247805080914, 26.559405314034112, 26.642714249752427,
+    42.165554862462585, 42.690134371612778, 62.296772141285579, 76.470998878090029,
+    80.168841443935662, 26.464157640787491, 2.5104175621899611, 55.32184724665035,
+    39.378584340397346, 42.523561855649874, 6.2776240380248964, 61.713400627902004,
+    80.38000000000001, 76.21822524387386, 58.343258797299207, 80.379999999999953,
+    31.658699928432021, 16.67628500161263, 27.036719084041266, 40.868622372268852,
+    50.227409360348354, 22.806961046349656, 80.379999999999995, 39.910245406427009,
+    80.379999999999939, 80.380000000000152, 28.913351933048453, 69.201754089364826,
+    10.827107479371746, 8.2565153327221452, 27.894764402426567, 62.797679037554538,
+    80.379999999999967, 10.003772112336256, 0.41254317071664565, 76.663181468535711,
+    80.379999999999995, 28.931368579234537, 66.758329308226308, 71.415256396426415,
+    5.8912333904136593, 49.306048088065751, 80.38000000000001, 80.379999999999995,
+    78.718378155895351, 31.349828897715518, 18.120985537377724, 80.379999999999995,
+    80.379999999999995, 80.379999999999995, 43.06020876252785, 39.935956756248508,
+    53.212462370006548, 80.380000000000024, 24.271629897878473, 80.379999999999995,
+    54.590440905150317, 3.5974915873275415, 54.768729120693337, 45.539214639450378,
+    46.092756364506869, 1.6231955328416858, 28.337512745230388, 36.126190171598267,
+    7.408587337385061, 80.380000000000024, 52.378013048517026, 80.380000000001658,
+    80.379999999999995, 80.380000000000265, 60.190234934744808, 80.379999999999995,
+    80.380000000000067, 15.119753073644151, 80.380000000000194, 70.218966428321295,
+    65.711611256966691, 39.449439119003131, 80.379999999999995, 34.896055435367224,
+    34.715151333176479, 80.379999999999967, 80.380000000000024, 51.820098147239435,
+    27.021625372805158, 42.477455254943919, 30.860677940548051, 46.830598552971225,
+    54.21261437885277, 59.737309280810507, 40.024322038678456, 58.468055614669161,
+    37.382826952297677, 20.307202712269273, 14.217875345210848, 53.677955605769633,
+    2.1780272219622634, 70.456796249148994, 34.015856626371743, 21.936305830525267,
+    42.515285997269757, 64.498035276415735, 80.379999999999995, 25.586659843165702,
+    32.65368196776771, 79.543788282545236, 44.273206499089433, 80.380000000000791,
+    7.368901568496721, 79.299978151813391, 80.379999999999853, 51.746020019520529,
+    61.830135084164922, 39.97052696037121, 8.8045963277608763, 74.13088984858706,
+    60.311611867614232, 80.379999999999995, 80.38000000000001, 61.633642089784921,
+    46.663706040145264, 11.105387487922464, 32.348400728232541, 11.858083003571117,
+    80.379999999999981, 58.69855706860497, 61.213168422836866, 76.186005379731327,
+    65.616588383287166, 50.32522996960855, 80.380000000000081, 80.379999999999981,
+    80.379999999999995, 80.379999999999981, 32.233023149839973, 78.465663975555401,
+    49.246687004793849, 24.215740812231957, 69.154214072619254, 4.09014871276701,
+    70.378579807419712, 45.047712392768062, 39.424998268882561, 45.025886730616257,
+    80.379999999999995, 80.379999999999981, 80.380000000000024, 67.348591955392919,
+    80.379999999999981, 3.950626389430318, 46.187913513585805, 80.379999999999995,
+    32.919141243627017, 13.440881197635271, 23.657741366164608, 34.704906316236979,
+    80.379999999999995, 74.017067268721703, 80.379999999999995, 29.408713070644776,
+    32.99734322354221, 1.6722351090681009, 43.872527935467311, 19.182187527648001,
+    80.380000000000038, 80.379999999999981, 56.026902110679643, 29.058835910691268,
+    48.087087456524905, 1.2683457769314799, 65.22641954132618, 72.92606673317043,
+    54.11145974585024, 45.037754877618546, 80.379999999999924, 58.696226161184121,
+    79.082457321419042, 80.379999999999981, 12.914062319848062, 34.892988327280456,
+    13.217806591202717, 4.5329195593609688, 22.494542464091118, 9.8073322809748795,
+    41.265391372289493, 20.78828233142519, 7.8865238510958928, 59.827681679817609,
+    59.299568164107683, 33.296270502987397, 80.38000000000001, 22.982298580088607,
+    29.308592150314816, 56.988652178847907, 80.379999999999995, 32.697135931400688,
+    59.043163345291838, 34.356803647332484, 43.960093109133169, 77.486775505825236,
+    8.2087522344794426, 79.223581623304042, 73.916322001847192, 33.073698599234561,
+    67.438529208534575, 80.379999999999995, 70.689949001495776, 56.372041574301839,
+    51.260531196619894, 12.298978581675554, 20.447395130633062, 80.379999999999924,
+    0.3907110810753332, 46.594309106563529, 80.379999999999995, 22.485844345491099,
+    36.551477248525387, 30.405378118211495, 25.840806079049592, 33.023595365852003,
+    12.670033027763385, 4.5728942239128463, 65.566539096118547, 31.25760610376787,
+    46.344982921991175, 53.709799883031025, 57.709044644697414, 75.086462720775813,
+    12.8254101957224, 59.925318598120995, 3.4608184173451151, 33.967592387106151,
+    20.188287471726081, 41.498942947465537, 16.880164154500712, 48.240578094869413,
+    80.379999999999995, 4.9972646564006471, 21.045925549824172, 74.791764464190265,
+    75.126390698203679, 38.9232765959798, 80.379999999999995, 54.501333378230846,
+    39.623913713213661, 6.4077995469653661, 73.496854742063505, 25.252688202570113,
+    20.481812123962023, 76.62335421055009, 61.260025997270986, 36.95285862965698,
+    68.203380652374207, 36.713721037384524, 8.0138679211945618, 7.4784948662018715,
+    23.415990951020316, 51.97657645793155, 38.628906945347651, 80.379999999999995,
+    80.379999999999995, 26.295572165232311, 21.634169761941941, 80.379999999999995,
+    38.931191404358124, 56.902860613166858, 45.347016706012063, 2.998537349101754,
+    38.188937746824962, 8.8791479527819526, 80.379999999999995, 76.07325868230582,
+    17.49076830746089, 75.125062234855037, 17.233708205255429, 60.205407671793679,
+    39.293589121331202, 4.561343613462717, 36.104074423492506, 52.366044037096415,
+    39.542404635163578, 33.200178171281287, 80.380000000000166, 62.670219415755746,
+    15.081464393994228, 80.380000000000067, 1.5489849198698442, 27.680127530862919,
+    64.964713813616214, 27.137086516866759, 21.592520431073034, 80.379999999999995,
+    54.322204138489376, 61.514019303142859, 80.380000000000024, 60.750332669551021,
+    15.397093911613293, 77.86320448650558, 11.472791835441132, 80.379999999999995,
+    60.924184296284828, 9.1179835456745124, 80.379999999999995, 80.379999999999967,
+    38.854851392824671, 27.342880561569562, 31.636771351521119, 60.442626387576787,
+    78.877506689678242, 80.379999999999981, 8.3671392169962964, 80.379999999999995,
+    80.379999999999995, 80.379999999999981, 13.884029865636581, 56.502342791452421,
+    13.780439065200467, 67.290193932819463, 49.38561194781655, 76.016934394340112,
+    21.320707665563077, 67.437847811393496, 80.38000000000001, 14.486595556149068,
+    80.380000000000123, 18.496150488342728, 80.379999999999953, 61.927125052142507,
+    80.380000000035352, 76.726802984608995, 23.714601463849554, 65.761939727252894,
+    57.045935236950498, 80.379999999999995, 45.069281506653788, 72.223678832944444,
+    46.990514571461816, 32.833257342160202, 52.185560724740775, 37.569940516296853,
+    80.3800000000018, 67.275544226314153, 59.062187640231812, 31.246946328732797,
+    42.871496136344319, 14.328269011988844, 38.402992123985044, 53.037050777831816,
+    80.379999999999995, 29.107695015342919, 80.38000000000396, 37.77883773482111,
+    30.490485281455616, 24.592418373591855, 46.490311061575746, 18.879448551400191,
+    39.944211276918814, 20.506685266135456, 80.379999999939642, 62.296698934370653,
+    64.441117433415769, 53.928107986998832, 59.787508206832157, 73.701596949368252,
+    42.063057594370356, 53.276408614624408, 21.290431738128326, 78.624040026191437,
+    68.875353351894873, 40.999185726766733, 22.615881252943172, 14.731574275896559,
+    19.465874051582951, 36.812669425277591, 38.676193187037327, 7.4159013290407501,
+    57.665489952142565, 49.911918657063893, 80.379999999999995, 80.379999999999995,
+    28.332241362007526, 8.5452656501155353, 80.379999999999981, 80.379999999999967,
+    35.285684894901955, 11.782872029933076, 28.218821182538548, 18.62329536735281,
+    15.655506083912206, 80.379999999999995, 34.079753123210104, 80.379999999999981,
+    0.78937511981994679, 36.105936770248476, 25.688044673722025, 52.457141937167314,
+    80.38000000000001, 28.529625695068066, 80.38000000000001, 67.642129903108071,
+    29.512311591626773, 80.37999999999856, 14.465529944107463, 40.439331340322312,
+    80.379999999999995, 73.480636766123212, 66.800923440413243, 58.452726706103704,
+    46.321315290905851, 62.975739897659921, 53.434957463032219, 24.157130415803817,
+    26.586148483261244, 1.6538799969555487, 34.763218597625198, 1.096427505581349,
+    18.821347852887428, 47.980036135597672, 33.45000805601061, 80.379999999999995,
+    58.439011408226648, 31.065673778936866, 32.559160555101371, 15.325517291767937,
+    7.5324088276359014, 77.986624130778992, 21.422782438681406, 80.380000000000052,
+    16.619648323621433, 53.667188359879241, 80.379999999999995, 62.935497536016896,
+    4.9910507535863866, 68.815912663322905, 80.379999999999995, 64.857079846742948,
+    0.72140987028613635, 5.6905888456976479, 55.817976187597509, 66.753036341002058,
+    48.937587510168854, 80.379999999999995, 24.838485367867229, 2.008377399236049,
+    80.379999999999981, 80.379999999999981, 2.6896494288253323, 80.380000000000209,
+    13.181521893800804, 52.840389476816661, 3.1866293955084752, 64.249400136207981,
+    36.288120451286787, 9.7062833725724449, 73.166777965285505, 18.121281829422276,
+    5.6362812068705281, 59.264426726622617, 44.986073025049961, 48.665896388129198,
+    80.379999999999981, 58.678213407902533, 41.98541926530639, 47.127510008598151,
+    64.630891645316396, 42.155266713270727, 45.769561301075335, 17.710713114999383,
+    10.204336996436417, 80.379999999999981, 78.398236198117417, 30.764791282138631,
+    34.897655580718258, 31.696513227742564, 41.589346707871613, 56.069458335217377,
+    41.904888024238758, 49.631383106871567, 69.406350677511966, 75.611646738589968,
+    38.061032093674285, 80.380000000000024, 43.59518537084702, 36.722065192027202,
+    25.15663412637144, 7.5042593924421794, 80.379999999999995, 53.189530432998609,
+    35.674286351357189, 8.0097396578483959, 80.38000000000001, 64.941011295608121,
+    35.604732803181975, 36.043959164099832, 80.379999999999995, 6.3289847200513663,
+    45.920757232857902, 62.36101365239837, 37.575447098939769, 76.398943230228198,
+    11.944229911754725, 30.017275149812555, 9.4017908344160723, 31.810233416995235,
+    65.415901887102805, 33.172099437040842, 5.6029923922742002, 80.379999999999939,
+    39.273409675509505, 52.481495543980749, 36.349860008671598, 52.867961196330143,
+    80.379999999999995, 30.820452379077452, 22.739337141415401, 7.8493466362288062,
+    54.632026295718497, 5.8606989670025706, 80.379999999999995, 60.646770627523438,
+    73.695027073679213, 69.797742083082142, 55.94494666480994, 43.829249062480798,
+    80.379999999999981, 30.10175042631597, 80.379999999999995, 17.614894195095754,
+    75.417024603356623, 55.527329185818225, 29.403899224128946, 41.084894994931794,
+    39.424578590820623, 57.546419006789698, 40.600521132330989, 80.38000000000001,
+    80.379999999999995, 80.379999999999995, 47.366590052060616, 80.38000000000001,
+    58.933086782714291, 73.135465988485876, 19.350564543103314, 52.58654695619331,
+    59.586985769561011, 18.271995451146214, 6.9876292704470471, 35.004604744844862,
+    80.379999999999995, 40.397557871565532, 24.87032319572252, 2.8289619171843063,
+    8.2502908385782234, 53.432784303532323, 78.094586160185628, 63.407337030992423,
+    31.086078341340372, 9.4752324028839521, 45.446603971798211, 29.671559187561225,
+    80.380000000000067, 27.591230309917137, 15.436379658724706, 46.494946394367616,
+    41.986282294935172, 27.577870784765118, 43.674991966129141, 43.354250353273329,
+    76.679270663569582, 41.002443271368705, 77.105663042669164, 60.501306259221231,
+    38.295071404481632, 22.60903599940546, 21.227861853117513, 64.182535550439411,
+    53.70431600397913, 43.259452426952613, 38.945490782744635, 5.2357813689540675,
+    32.015740812378361, 80.379999999999995, 14.51749240323122, 80.379999999999995,
+    66.079070671831857, 7.511953333842154, 73.436160382143598, 29.479264359077074,
+    80.379999999999995, 33.0547942448177, 43.610285150751174, 45.367822284257016,
+    24.402155500069288, 80.379999999999995, 80.380000000000024, 7.6798264746094969,
+    13.549772977023869, 77.647756260703716, 65.760528136426828, 29.81809896977472,
+    66.156357136519958, 1.4565444313119116, 55.153771058617245, 26.989733060033721,
+    57.494299120646104, 25.907861216027943, 72.583195807528853, 37.402273143455226,
+    47.608435705052159, 79.134853597288625, 78.287052386596315, 57.635955243327139,
+    42.789125828220484, 54.025186400686785, 39.839643356893319, 61.64161142331222,
+    21.893854479627805, 41.656477884178614, 35.932844621076327, 50.831430496560841,
+    80.379999999999981, 72.929156043612977, 77.874439969927707, 6.2024674415421028,
+    44.179776164502876, 16.108299956969617, 5.7047291670244524, 48.306944979011291,
+    28.878720512616315, 1.6276276224269131, 2.6965707752844112, 14.424669251965595,
+    41.522290042887199, 44.513712838931532, 80.380000000000024, 12.671265167159419,
+    37.374648927627156, 78.024241715585546, 55.46789778349055, 56.784810622906406,
+    42.875552051478692, 34.925840214100504, 3.8342860075819503, 43.511382040887092,
+    48.092793561016521, 32.509706073734762, 23.218926827209742, 57.64408077959537,
+    31.360591492298965, 80.379999999999995, 25.136302715086881, 20.903283834517975,
+    19.063549246101072, 48.999677480337773, 76.357862413745863, 63.369277677692025,
+    41.316497853007483, 12.692834971629013, 48.360076289990729, 40.392603807928879,
+    75.410088434845633, 80.379999999999995, 80.380000000000038, 23.721624687932636,
+    8.7460353843608143, 22.659434680595638, 46.727982534050227, 80.379999999999995,
+    10.008384943142753, 33.553493227956487, 24.099521005425949, 37.638934890634218,
+    21.324759803473665, 80.379999999999995, 38.181762599034492, 57.928482664338915,
+    76.133296578235431, 48.752214714772947, 16.99459606675671, 40.14916294143864,
+    58.252653998289802, 55.835608037617703, 52.323412484505539, 61.343118146388932,
+    55.409958553395292, 75.625774344901203, 10.943554886681513, 34.868748077844394,
+    1.2195465525241176, 80.380000000000052, 25.278594068821324, 20.620988870579513,
+    38.688107805450969, 64.312946133941821, 74.540709174706251, 70.955909011854914,
+    55.263908447292479, 1.6472951200415897, 19.050815204644028, 47.997569025133103,
+    75.687375135371866, 57.466935443863548, 30.572014652767141, 70.37896290687037,
+    61.605966853104846, 26.70300262490532, 63.65210059156248, 47.357590555930152,
+    15.691121224547357, 21.629236451725792, 8.2973917097767504, 80.38000000000001,
+    62.979980097809594, 40.137988601651521, 80.379999999999995, 68.149117347184642,
+    27.054566628093195, 39.743963010093793, 80.379999999999995, 40.000042563257587,
+    80.379999999999995, 36.130748474679613, 28.486085280716129, 80.379999999999995,
+    0.84941616474232018, 31.083019340330932, 28.042068758464161, 44.863002434092138,
+    25.488418770207563, 19.035244943895115, 26.542614043780151, 57.774440168837451,
+    79.202460229580836, 56.336219979041672, 51.097764314174547, 35.266303461560682,
+    57.34511684591272, 45.891745065272737, 3.0064690589965379, 23.91351189968454,
+    42.941762713616455, 80.379999999999967, 61.824696250908964, 32.580781801473584,
+    38.741628664424987, 69.877402209550965, 58.751749976134128, 42.236588997598894,
+    69.771555615487273, 35.682496963691975, 48.341984815204889, 80.379999999999995,
+    48.559318044702735, 73.553227355074867, 80.379999999999995, 65.235477012215952,
+    80.379999999999967, 80.379999999999995, 20.80141306089001, 21.234331663329534,
+    27.433601923766542, 48.287509942463451, 32.197272216088884, 19.523724269783134,
+    5.217958972398729, 80.379999999999995, 80.380000000000024, 13.514416615993731,
+    35.606912283427711, 74.036649490224264, 80.379999999999995, 80.379999999999995,
+    49.759768957052259, 10.815314301329378, 37.23055659619417, 37.538721115246005,
+    23.224140388112968, 80.379999999999995, 48.65438227108104, 68.737625417023807,
+    70.013581822406209, 40.660885264551837, 80.379999999999995, 71.001158030660832,
+    4.9036787193593057, 80.379999999999981, 56.046361192310272, 80.379999999999995,
+    80.38000000000001, 18.898212353577797, 49.908322117800438, 57.327215352598351,
+    15.147516873773686, 79.939837602361706, 73.552463012857942, 57.144773750858988,
+    4.568212565105136, 10.802862244273223, 65.674823331379727, 54.429793591105216,
+    63.059966601145803, 37.274525518285138, 34.351341605440432, 15.043341051366257,
+    22.398475242831633, 80.379999999999995, 11.121796622749729, 19.018614170451155,
+    80.379999999999967, 39.452081083261177, 32.866315147292084, 72.155653574718386,
+    53.417485451853409, 5.7479656606868401, 6.3122424735210743, 31.189541046471099,
+    63.523777760247832, 17.327968300017979, 80.38000000000001, 80.379999999999995,
+    57.885916071699576, 80.379999999999995, 19.484403724916771, 12.119052819891138,
+    80.38000000000001, 37.842785823718394, 77.156835186347962, 39.561603854899268,
+    23.068375476114241, 67.471036518069155, 25.524377782726315, 66.783656787579091,
+    51.106757770774493, 32.771571716521564, 63.265014304036555, 66.680812877540362,
+    24.03757933354095, 72.382091743910294, 67.916490194166698, 80.379999999999995,
+    8.8112530958082314, 80.379999999999995, 46.655785172780789, 18.240320165578797,
+    64.785196464565246, 80.379999999999811, 15.440879361367505, 32.612879419199302,
+    77.729185303676275, 26.629974062584459, 64.777788599583388, 25.367958162501232,
+    55.721798894569027, 3.0379521215932765, 17.385867873726344, 80.379999999999995,
+    21.833340407184973, 80.379999999999981, 9.9471919147299079, 55.375562277188294,
+    67.880300321680622, 80.379999999999995, 80.379999999999995, 57.370604778324896,
+    35.762081315242042, 20.507898408741074, 68.244905462529374, 76.071147750376326,
+    39.684755009397868, 22.023620790914393, 3.919529432480461, 41.676068858747001,
+    59.208308948699674, 24.358488052410099, 60.31854073925188, 48.489084043290454,
+    20.577120842473668, 43.707724455707734, 27.599854217844971, 3.0614283327376204,
+    15.988301777150804, 46.950559712032153, 60.019065227450483, 74.573285575689937,
+    80.379999999999981, 58.459052229195187, 66.368187256985024, 47.094734947064296,
+    52.380916345720266, 80.38000000000001, 9.3254009084020915, 25.162021795509187,
+    20.787638226404798, 24.964198008882224, 21.00612149070944, 80.379999999999995,
+    80.379999999999995, 40.93693679938923, 45.57268682063598, 37.618697649204449,
+    3.3379318412053522, 59.590406108448065, 8.6958467354773159, 80.38000000000001,
+    80.379999999999995, 62.773575316868332, 79.260801094594427, 74.436559185976932,
+    50.818998321998365, 80.380000000074034, 38.250249436755297, 40.911530764725654,
+    55.925557698217425, 30.29699876152694, 56.19164197831283, 39.470089820679853,
+    80.380000000000024, 5.1269893582835753, 69.615879741487902, 33.091127676560355,
+    62.466852001639047, 80.379999999999995, 80.379999999999995, 53.397088301997819,
+    80.379999999999981, 35.216710958468127, 58.918672266827755, 49.361791753902018,
+    43.554859630932292, 38.909786966395785, 52.084070315758787, 54.542975400215269,
+    80.38000000000001, 75.499527561511854, 35.855209992906545, 43.577769626109131,
+    47.593645838453433, 15.86855959079635, 43.47337015436532, 58.878735933042577,
+    61.852493093237157, 23.4226792584146, 80.379999999999939, 1.4857037136674167,
+    41.545146036691342, 28.792544619454834, 12.151549478712008, 66.094321005046282,
+    68.260635802614829, 80.379999999999995, 80.380000000000024, 44.300715873013765,
+    2.5906807065547199, 52.979472458307498, 64.07240117997803, 14.47527106690527,
+    17.244917606327874, 80.379999999999939, 61.761484232739306, 80.379999999999995,
+    80.379999999999995, 55.574916853275717, 15.891936626959858, 8.8253961874794893,
+    56.531096938711279, 11.366976330116517, 34.63853546358034, 37.721710921639833,
+    80.380000000000024, 80.379999999999995, 4.8785276958825143, 80.379999999999995,
+    58.020856880937778, 52.444342214808046, 55.61082632164532, 80.379999999999995,
+    80.379999999999995, 22.314072415918343, 44.406727683520685, 80.379999999999995,
+    48.422242472574595, 15.742009800480687, 17.826873634136035, 80.379999999999896,
+    56.283334024944764, 41.103228098633103, 6.0327672884657106, 26.548990816934516,
+    8.8547903700694661, 9.0161952239789827, 49.892836198487089, 76.053780739347403,
+    16.155780490372148, 76.55392340226436, 60.366571046404623, 37.622920472340752,
+    10.736383460449435, 69.217031649861823, 55.589712131000063, 31.841196983861408,
+    24.980953333485044, 4.6125201640021931, 43.117581674496599, 25.980236746701774,
+    51.307908814176656, 42.695524033624807, 9.2228930761093348, 80.379999999999981,
+    74.562624948295422, 72.110596618979926, 49.89532234181732, 32.065301314915125,
+    55.809119290679305, 79.782091356549273, 80.379999999999995, 80.229610453306549,
+    80.379999999999995, 33.308046872561306, 80.379999999999967, 74.429105748341215,
+    13.257700472187556, 71.832477114736108, 16.356145291037759, 80.379999999999995,
+    80.379999999999995, 15.584224228778732, 72.238234923609767, 30.088307693925923,
+    58.48863094043633, 7.167173416970253, 80.379999999999953, 24.772988115299334,
+    27.727938807431237, 38.655380119041091, 32.395601549693161, 32.262087377124509,
+    35.700675211286928, 59.452558579186636, 80.379999999807026, 80.380000000000038,
+    20.04763979690776, 4.8768141586267886, 80.379999999999995, 80.379999999999995,
+    36.10232991941789, 4.1227902695214027, 48.129793565423689, 80.379999999999995,
+    17.603497278807016, 34.082429247202633, 80.379999999999995, 42.932877661808519,
+    48.64426297062991, 32.928897133100946, 48.202001974341947, 30.562418310332195,
+    34.994024444637802, 40.773995748708934, 75.902648221019959, 6.8199724969885427,
+    15.083504502506832, 0.064878187581087793, 43.03263900198619, 12.230877743926182,
+    20.896561728651747, 8.228604187472655, 22.119920022461422, 45.555801170142232,
+    42.265366511333006, 3.0202654001676219, 49.987982661954646, 16.392912704784937,
+    14.660190120930686, 72.957159396844389, 7.7970822574911827, 0.88608254832379196,
+    60.228159361504098, 7.7513923170304571, 68.609910904646611, 40.704142029124476,
+    78.494718337026924, 10.321675201018405, 63.738701409005984, 23.404155304505775,
+    50.98985837667491, 67.557089658223248, 73.293995088230943, 18.758410403432499,
+    56.800838380849662, 26.453636453777293, 80.38000000000001, 19.491770123421325,
+    49.603816996806735, 37.613652992044521, 55.982582353766276, 75.667448303329834,
+    49.734350248538007, 19.494913662065585, 80.379999999999995, 0.36490324273743951,
+    80.380000000000024, 71.173836187717967, 80.380000000000024, 40.132915741082329,
+    53.316906421039668, 54.011439099222457, 80.380000000000052, 55.901709217076615,
+    15.651738518274568, 46.664406183700791, 38.86122960856428, 74.133150050016951,
+    57.285114265258443, 50.879544523072617, 40.281599565815341, 80.379999999999995,
+    20.014976903943467, 14.40510105442776, 2.8235470828806863, 59.15957333513456,
+    80.379999999999939, 31.69686691300674, 34.957472604228265, 80.380000000000024,
+    80.379999999999995, 10.206622168686172, 40.397839505059267, 80.379999999999995,
+    23.251197826139315, 71.084247257371629, 46.02726928201578, 35.350914079534121,
+    4.3573461423630926, 56.195917634437336, 73.052235181784653, 5.5896452316027077,
+    28.370538521936041, 19.831560769393803, 59.29464744908303, 58.844482229629932,
+    24.831221444919798, 33.303277442696377, 34.320521162639807, 80.380000000000052,
+    80.380000000000294, 60.168149697308351, 30.682064161163751, 18.645967861118518,
+    80.379999999999995, 0.044324974848135787, 19.30527317712292, 26.171164582036234,
+    46.464442561026097, 63.813481531595556, 59.093456286972035, 68.750608667044418,
+    50.148326364328312, 20.154535003088188, 71.659415272824376, 6.7729513199808542,
+    64.256485397566067, 50.552202448912382, 67.56622641445685, 55.793085711586734,
+    80.38000000000001, 80.380000000000393, 76.135103494412959, 25.627621408055148,
+    29.991510458428486, 66.903243124254828, 38.554106879953792, 80.379999999999995,
+    40.256048923888528, 67.605046723420614, 74.157857939196873, 80.379999999999953,
+    15.217502160118894, 50.658558929148313, 9.2400327827511433, 3.2236069355221568,
+    21.601591156664533, 80.379999999999995, 36.108321185800392, 80.379999999999995,
+    80.379999999999995, 80.37999978528434, 80.379999999999981, 80.379999623445883,
+    80.379999999999967, 80.379999427335449, 80.38000000000001, 80.380000738165947,
+    80.379999999999725, 80.379990435574996, 71.029240541014659, 80.37999768642311,
+    80.380000000000081, 74.047824421415996, 80.379999999999995, 19.903037662219482,
+    68.732292982990273, 80.37999972482389, 80.379999999999995, 80.37999973492181,
+    80.379999999999995, 19.520517247636661, 80.379999999999995, 80.379999051422431,
+    80.380000000000024, 53.879525301294372, 80.379999999999995, 58.225090069699228,
+    66.246361111846241, 80.379999844677698, 80.379999999999981, 80.379999615926451,
+    80.379999999999995, 80.380000480397342, 80.379999999999995, 19.374754143316444,
+    80.379999999999995, 80.380000048151999, 80.380000000000024, 80.379997036397157,
+    80.379999999999981, 80.380000024516207, 44.734865932246308, 74.10576297316166,
+    80.379999999999967, 52.798436363927976, 80.379999999999995, 80.380000135077907,
+    80.380000000000095, 80.380276043827337, 80.379999999999995, 80.141305741278359,
+    80.379999999999995, 47.598584524680142, 80.38000000000001, 80.379995066116479,
+    80.379999999999981, 80.379999979573654, 80.379999999999995, 5.4499582272407512,
+    80.379999999999995, 45.150725559305769, 80.379999999999995, 80.380000044336398,
+    65.348499011039195, 11.070752484178978, 80.379999999999995, 30.850583333179582,
+    9.6434218964484195, 80.380000018532897, 80.379999999999967, 80.380389195931514,
+    80.379999999999995, 16.932554768622015, 80.379999999999995, 80.380000393316365,
+    80.380000000000067, 38.130100779516283, 80.379999999999981, 80.379999886598128,
+    22.431852149084058, 80.380000000618054, 35.040666720610396, 80.379993954173699,
+    80.379999999999995, 80.38000023024405, 80.380000000000109, 80.37999914535267,
+    62.303090196891084, 80.379999930285109, 80.379999999999981, 14.001940592904516,
+    80.379999999999967, 77.465664708576213, 80.379999999972284, 22.864553469174634,
+    61.818685608950766, 46.525570668996515, 32.072630651161596, 80.380002737226818,
+    80.38000000000001, 30.440479538110612, 80.379999999994823, 20.014181024541305,
+    80.379999999999995, 39.468343586988851, 43.122235251260427, 80.380000007802806,
+    9.7613884535941668, 80.379998391316121, 80.379999999999981, 80.380003598016344,
+    66.841044474658347, 80.379999517984274, 80.379999999999995, 49.164916638299601,
+    80.380000000001075, 80.380000325818855, 80.380000000000067, 48.974661627641581,
+    80.379999999999995, 80.379999614444358, 80.379999999999981, 80.379999928986123,
+    80.380000000000024, 80.380000822080476, 80.37999999999964, 80.380000522009993,
+    80.380000000000024, 24.357063254877858, 80.379999999999995, 80.379999734474467,
+    80.379999999999995, 80.379999929551744, 80.379999999999995, 80.379999900365306,
+    80.379999999999995, 80.380237497893248, 80.379999999999967, 27.004364747042349,
+    80.379999999999995, 80.380000483870802, 80.379999999999995, 80.380279928747399,
+    80.379999999999981, 52.277419027824685, 65.484474011296058, 80.379989794531014,
+    80.379999999983667, 77.829253764729998, 19.412601467715081, 53.671222286857208,
+    80.379999999999995, 12.936025509746067, 80.379999999999953, 72.761083975909784,
+    80.379999999999981, 80.379997279492798, 80.380000000000095, 80.380000165314925,
+    80.379999999999967, 80.380000035690117, 33.808053968433015, 80.379999614329634,
+    56.554370994277136, 80.380004191227059, 80.379999999999995, 10.626519483984621,
+    16.615453452749328, 15.386502262492078, 80.379999999999995, 80.380000030874442,
+    76.1932240032626, 80.379999641357756, 23.942646827715897, 80.379966175480135,
+    79.132718890490523, 80.37999983446737, 80.38000000000001, 56.407376744110564,
+    80.38000000000001, 80.380000913248722, 80.379999999999995, 80.379990184141349,
+    80.379999999999612, 80.38000000030533, 80.380000000000038, 80.379627920266316,
+    26.392926839121806, 52.150530780923226, 30.283043832928428, 80.379989576554124,
+    80.38000000000001, 80.380000024668334, 80.380000000000649, 72.66722036737427,
+    80.379999999999995, 80.379840397882901, 80.380000000000109, 80.379999872552887,
+    24.429858546949781, 80.379998909113496, 80.380000000000408, 80.380000139908191,
+    80.379999999999967, 75.341201971548898, 37.411658513002685, 57.604179883564456,
+    80.379999999999995, 80.379999784367556, 66.832024747901102, 80.38000018506726,
+    80.379999999999995, 80.379999743608451, 80.380000000000081, 80.380136714248522,
+    27.139757464748691, 80.379999712841951, 80.379999999999967, 80.37999960637103,
+    80.38000000000001, 80.379999979998516, 80.379999999999995, 80.380005231042148,
+    80.379999999999995, 36.6068820213344, 80.379999999999981, 80.380002062727357,
+    80.380000000000052, 51.921815050262872, 80.379999999999981, 80.380000266566768,
+    80.379999999999995, 80.380147835139226, 54.871364870514199, 76.323357043936198,
+    80.380000000000038, 80.380000270183501, 18.551216695547307, 35.387746095088595,
+    80.380000000000024, 80.379966105606087, 50.947524390824988, 80.379998479304305,
+    80.379999999999981, 80.380002746622637, 71.823514254920298, 71.505070077836081,
+    80.379999999999839, 80.380002594643287, 80.379999999999725, 80.379999808678917,
+    80.379999999999995, 12.762745494949126, 18.056282912685337, 80.380087725066147,
+    3.3096087682188675, 80.379998537697617, 80.379999999999995, 48.012677242750492,
+    80.380000000000024, 80.380000038269884, 80.379999999999967, 80.380009395998982,
+    80.380000000000024, 22.504531293999374, 27.742073064580094, 80.379999397091808,
+    80.379999999999995, 80.379999232467881, 80.379999999999782, 80.380000870727415,
+    80.379999999999981, 69.395876113005684, 80.379999999999981, 43.449643060458037,
+    80.379999999999995, 79.030680434119276, 80.379999999999995, 25.295227628018793,
+    2.5505737781477049, 80.380000203583165, 80.380000000000351, 80.38000517838303,
+    80.379999999999995, 3.8293500758741934, 80.38000000000001, 6.5829125503365518,
+    80.379999999999995, 80.380020621325002, 80.379999999999967, 80.37998335217371,
+    80.379999999999995, 80.379828554383295, 80.379999999999995, 80.380000030233148,
+    47.313786017588029, 80.380000711053896, 80.379999999999995, 80.380063565247838,
+    80.380000000000109, 13.481311564976302, 80.379999999999995, 80.380000330310807,
+    80.379999999999995, 80.379999536936225, 80.380000000000024, 80.379999735356577,
+    80.380000000006078, 80.379999036549464, 80.380000000000024, 39.471036049618348,
+    80.38000000000001, 80.380017438285904, 80.380000000000081, 37.404261160565333,
+    80.379999999999995, 80.379999775646212, 80.379999999999995, 80.380000251060153,
+    80.379999999999995, 80.380000217517107, 78.297484133071421, 80.379999475085285,
+    80.379999999999981, 79.867693274485916, 72.787983171932737, 74.969516795179359,
+    36.841436402051514, 80.380013828373691, 80.379999999999995, 60.172121001629371,
+    80.38000000000001, 80.380002835132828, 80.379999999999967, 80.379994111384804,
+    3.7764370767750597, 80.37999998820861, 80.38000000000001, 80.379999790593217,
+    80.38000000000001, 80.37999951709493, 80.379999999999995, 80.380000196866092,
+    80.379999999999981, 13.799906669893343, 6.0066880047024451, 80.379999975891621,
+    80.379999999999995, 38.805165478344506, 76.623671605886145, 80.37999920076571,
+    59.171895740526075, 80.38000145035366, 80.379999999999995, 80.380004039836763,
+    80.379999999999995, 80.37999995515888, 80.38000000000001, 11.384070485110309,
+    80.38000000000001, 80.37999978267942, 80.379999999999967, 80.379999826187287,
+    28.920964492056715, 32.24741313317098, 80.379999999999995, 80.380244563643132,
+    80.380000000000038, 80.380034379424572, 80.379999999999995, 80.379999949924297,
+    80.379999999999995, 80.379991499804731, 80.379999999999995, 80.380000223456207,
+    80.379999999999995, 80.380166903315327, 80.379999999999995, 76.604794951802319,
+    80.380000000000052, 80.380000031836843, 6.7011993156332945, 60.494874602733823,
+    80.379999999999953, 80.380000035568628, 80.379999999999825, 19.428506962472365,
+    80.379999999999953, 53.214242331663385, 41.714451631628222, 80.380001176604466,
+    80.379999999999995, 44.05641641423113, 80.379999999999995, 80.381225571347343,
+    80.379999999999967, 76.094774443842596, 69.514008541944747, 54.603872212115753,
+    80.379999999999995, 80.379999689867901, 5.2764312035464425, 2.1036498911655142,
+    80.379999999999995, 8.8701794661684161, 80.379999999999995, 80.380001499142423,
+    80.379999999999939, 80.380002120294279, 80.379999999999981, 53.144930322850783,
+    80.379999999999995, 80.379999473911013, 80.379999999999981, 80.38000089872034,
+    80.379999999999995, 80.379989200095878, 80.379999999999967, 54.458258774285255,
+    74.068574097735436, 80.379999978873556, 80.38000000000001, 80.380000019710664,
+    80.379999999999967, 80.379999923781369, 80.379999999999995, 80.379998809662908,
+    80.380000000000052, 80.380002516689387, 80.379999999999995, 78.584701735719648,
+    80.379999999999995, 80.380002023166071, 80.380000000000095, 80.379999923514504,
+    80.379999999999995, 80.380000331063584, 80.379999999999981, 39.0002866481111,
+    32.565037453361995, 80.379998885833089, 80.38000000000001, 80.37999729679521,
+    0.73809415239919107, 80.379999852461395, 80.379999999999995, 80.380018717266012,
+    80.379999999999981, 14.36387708073886, 37.737045696814732, 80.379998761924071,
+    80.379999999999995, 80.37999850785782, 44.655606464206286, 80.380000276003102,
+    80.379999999999995, 80.379999816906448, 80.379999999999967, 80.380000385796819,
+    80.380000000000564, 80.380000002074127, 80.379999999999995, 1.5351876558234827,
+    80.379999999999995, 52.869179296350914, 80.379999999999995, 80.379996604002443,
+    73.612529318587846, 23.13558292906631, 80.379999999999995, 80.379988799727414,
+    80.379999999999981, 72.14209103401069, 80.380000000000024, 80.380002264442737,
+    3.2584416488157393, 59.986563187607914, 80.379999999999995, 80.379956057016898,
+    80.380000000000052, 80.380000265875239, 42.127934098720857, 80.380000439839179,
+    80.380000000000152, 80.379999956001029, 80.379999999999995, 80.380000105439592,
+    80.379999999997608, 80.379999913472375, 22.468339414949522, 48.684945632877067,
+    80.379999999999981, 80.380013194372026, 80.38000000000001, 80.379999834436603,
+    80.380000000000038, 80.380000110368442, 80.379999999999995, 80.379999976383687,
+};
+
+#endif
@@ -0,0 +1,338 @@
+#ifndef _NEUTRINOSOLVER_H_
+#define _NEUTRINOSOLVER_H_
+
+#include "CubicSolver.hpp"
+
+#include <vector>
+#include <cmath>
+
+//solution with the smaller |pz|
+struct PzAbsMinimum
+{
+    static inline double select(double pz1, double pz2)
+    {
+        return std::fabs(pz1)>std::fabs(pz2) ? pz2 : pz1;
+    }
+};
+
+//solution a+sqrt(a^2-b)
+struct PzPlus
+{
+    static inline double select(double pz1, double)
+    {
+        return pz1;
+    }
+};
+
+//solution a-sqrt(a^2-b)
+struct PzMinus
+{
+    static inline double select(double, double pz2)
+    {
+        return pz2;
+    }
+};
+
+/*
+* Batched solution of the W mass constraint for the neutrino pz
+*
+*   pz = a +- sqrt(a^2-b)
+*
+* The lepton and MET inputs of several candidates are collected in
+* separate arrays and solved in one pass without branches. Which of the
+* two solutions is taken is a policy given as template argument, so each
+* choice compiles to its own kernel. The loop is left to the compiler to
+* vectorise; a batch holds the candidates of one event only, which are too
+* few for explicit SIMD to pay off. Candidates with a negative radicand have
+* no real solution and need to be handled by the caller.
+*
+* Every candidate carries its own W mass hypothesis. The terms depending
+* only on the lepton and the MET are computed once in add(); addMass()
+* reuses them for further hypotheses of the same candidate.
+*
+* The arithmetic follows the former per-candidate solution operation by
+* operation, except that the squares are plain products instead of pow.
+*/
+class NeutrinoQuadraticBatch
+{
+    private:
+    //inputs
+    std::vector<double> _leptonPx;
+    std::vector<double> _leptonPy;
+    std::vector<double> _leptonPz;
+    std::vector<double> _metPx;
+    std::vector<double> _metPy;
+    std::vector<double> _metEt2;
+    std::vector<double> _leptonE2;
+    //E^2-pz^2 of the lepton
+    std::vector<double> _denominator;
+    std::vector<double> _wMass;
+    std::vector<double> _halfMW2;
+
+    //outputs
+    std::vector<double> _a;
+    std::vector<double> _radicand;
+    std::vector<double> _pz;
+    std::vector<double> _energy;
+
+    template <class PzPolicy>
+    inline void solveScalar(unsigned size)
+    {
+        for (unsigned i=0; i<size; ++i)
+        {
+            const double mu = _halfMW2[i] + _metPx[i]*_leptonPx[i] + _metPy[i]*_leptonPy[i];
+            const double a = (mu*_leptonPz[i])/_denominator[i];
+            const double b = (_leptonE2[i]*_metEt2[i] - mu*mu)/_denominator[i];
+            const double radicand = a*a-b;
+            const double root = std::sqrt(radicand>0 ? radicand : 0);
+            const double pz1 = a + root;
+            const double pz2 = a - root;
+            const double pz = PzPolicy::select(pz1,pz2);
+            _a[i] = a;
+            _radicand[i] = radicand;
+            _pz[i] = pz;
+            _energy[i] = std::sqrt(_metEt2[i] + pz*pz);
+        }
+    }
+
+    public:
+    void clear()
+    {
+        _leptonPx.clear();
+        _leptonPy.clear();
+        _leptonPz.clear();
+        _metPx.clear();
+        _metPy.clear();
+        _metEt2.clear();
+        _leptonE2.clear();
+        _denominator.clear();
+        _wMass.clear();
+        _halfMW2.clear();
+    }
+
+    //the MET components are taken in single precision like in the original solution
+    template <class LorentzVector>
+    unsigned add(const LorentzVector& lepton, float metpx, float metpy, double mW)
+    {
+        const double E = lepton.getE();
+        const double pz = lepton.getPz();
+        _leptonPx.push_back(lepton.getPx());
+        _leptonPy.push_back(lepton.getPy());
+        _leptonPz.push_back(pz);
+        _metPx.push_back(metpx);
+        _metPy.push_back(metpy);
+        _metEt2.push_back(metpx*metpx + metpy*metpy);
+        _leptonE2.push_back(E*E);
+        _denominator.push_back(E*E - pz*pz);
+        _wMass.push_back(mW);
+        _halfMW2.push_back((mW*mW)/2);
+        return _leptonPx.size()-1;
+    }
+
+    //another W mass hypothesis for the candidate i
+    unsigned addMass(unsigned i, double mW)
+    {
+        _leptonPx.push_back(_leptonPx[i]);
+        _leptonPy.push_back(_leptonPy[i]);
+        _leptonPz.push_back(_leptonPz[i]);
+        _metPx.push_back(_metPx[i]);
+        _metPy.push_back(_metPy[i]);
+        _metEt2.push_back(_metEt2[i]);
+        _leptonE2.push_back(_leptonE2[i]);
+        _denominator.push_back(_denominator[i]);
+        _wMass.push_back(mW);
+        _halfMW2.push_back((mW*mW)/2);
+        return _leptonPx.size()-1;
+    }
+
+    unsigned size() const
+    {
+        return _leptonPx.size();
+    }
+
+    template <class PzPolicy>
+    void solve()
+    {
+        const unsigned n = size();
+        _a.resize(n);
+        _radicand.resize(n);
+        _pz.resize(n);
+        _energy.resize(n);
+        solveScalar<PzPolicy>(n);
+    }
+
+    double getWMass(unsigned i) const
+    {
+        return _wMass[i];
+    }
+
+    double getMetPx(unsigned i) const
+    {
+        return _metPx[i];
+    }
+
+    double getMetPy(unsigned i) const
+    {
+        return _metPy[i];
+    }
+
+    double getA(unsigned i) const
+    {
+        return _a[i];
+    }
+
+    double getRadicand(unsigned i) const
+    {
+        return _radicand[i];
+    }
+
+    //only meaningful if the radicand is positive
+    double getPzPlus(unsigned i) const
+    {
+        return _a[i] + std::sqrt(_radicand[i]);
+    }
+
+    double getPzMinus(unsigned i) const
+    {
+        return _a[i] - std::sqrt(_radicand[i]);
+    }
+
+    //solution selected by the policy, only meaningful if the radicand is positive
+    double getPz(unsigned i) const
+    {
+        return _pz[i];
+    }
+
+    double getEnergy(unsigned i) const
+    {
+        return _energy[i];
+    }
+};
+
+//..................................................................................................
+/*
+* Modification of code by Orso.
+* The real solutions are obtained for all candidates of an event at once by the
+* NeutrinoQuadraticBatch; this handles the candidates with complex solutions
+* by varying px,py of the MET. 'a' is the real part of the complex solutions.
+* The strategy is given by the template arguments:
+*   usePxMinusSolutions_, usePxPlusSolutions_: vary px,py to find the solution in complex case
+*   useMetForNegativeSolutions_: set root=0 in complex case
+* Returns false if no solution was found, p4nu_rec is left unchanged then.
+* LorentzVector is pxl::LorentzVector in the module, any type with its getters
+* and setXYZ/setE works.
+* WARNING! Use only pz component of the returned 4-momenta as the function adjusts the transverse
+* component.
+*/
+template <bool usePxMinusSolutions_, bool usePxPlusSolutions_, bool useMetForNegativeSolutions_, class LorentzVector>
+inline bool solveComplexNu4Momentum(LorentzVector& p4nu_rec, const LorentzVector& lepton, const float& metpx, const float& metpy, double a, double const mW)
+{
+    double pznu(0);
+
+    double ptlep = lepton.getPt(),pxlep=lepton.getPx(),pylep=lepton.getPy();
+
+    double EquationA = 1;
+    double EquationB = -3*pylep*mW/(ptlep);
+    double EquationC = mW*mW*(2*pylep*pylep)/(ptlep*ptlep)+mW*mW-4*pxlep*pxlep*pxlep*metpx/(ptlep*ptlep)-4*pxlep*pxlep*pylep*metpy/(ptlep*ptlep);
+    double EquationD = 4*pxlep*pxlep*mW*metpy/(ptlep)-pylep*mW*mW*mW/ptlep;
+
+    double solutions[3];
+    const unsigned numSolutions = CubicSolver::solve(EquationA,EquationB,EquationC,EquationD,solutions);
+
+    double solutions2[3];
+    const unsigned numSolutions2 = CubicSolver::solve(EquationA,-EquationB,EquationC,-EquationD,solutions2);
+
+
+    double deltaMin = 14000*14000;
+    double zeroValue = -mW*mW/(4*pxlep);
+    double minPx=0;
+    double minPy=0;
+
+    // std::cout<<"a "<<EquationA << " b " << EquationB <<" c "<< EquationC <<" d "<< EquationD << std::endl;
+
+    if(usePxMinusSolutions_)
+    {
+        for( int i =0; i< (int)numSolutions;++i)
+        {
+            if(solutions[i]<0 )
+            {
+                continue;
+            }
+            double p_x = (solutions[i]*solutions[i]-mW*mW)/(4*pxlep);
+            double p_y = ( mW*mW*pylep + 2*pxlep*pylep*p_x -mW*ptlep*solutions[i])/(2*pxlep*pxlep);
+            double Delta2 = (p_x-metpx)*(p_x-metpx)+(p_y-metpy)*(p_y-metpy);
+
+            // std::cout<<"intermediate solution1 met x "<<metpx << " min px " << p_x <<" met y "<<metpy <<" min py "<< p_y << std::endl;
+
+            if(Delta2< deltaMin && Delta2 > 0)
+            {
+                deltaMin = Delta2;
+                minPx=p_x;
+                minPy=p_y;
+            }
+            // std::cout<<"solution1 met x "<<metpx << " min px " << minPx <<" met y "<<metpy <<" min py "<< minPy << std::endl;
+        }
+    }
+
+    if(usePxPlusSolutions_)
+    {
+        for( int i =0; i< (int)numSolutions2;++i)
+        {
+            if(solutions2[i]<0 )
+            {
+                continue;
+            }
+            double p_x = (solutions2[i]*solutions2[i]-mW*mW)/(4*pxlep);
+            double p_y = ( mW*mW*pylep + 2*pxlep*pylep*p_x +mW*ptlep*solutions2[i])/(2*pxlep*pxlep);
+            double Delta2 = (p_x-metpx)*(p_x-metpx)+(p_y-metpy)*(p_y-metpy);
+            // std::cout<<"intermediate solution2 met x "<<metpx << " min px " << minPx <<" met y "<<metpy <<" min py "<< minPy << std::endl;
+            if(Delta2< deltaMin && Delta2 > 0)
+            {
+                deltaMin = Delta2;
+                minPx=p_x;
+                minPy=p_y;
+            }
+            // std::cout<<"solution2 met x "<<metpx << " min px " << minPx <<" met y "<<metpy <<" min py "<< minPy << std::endl;
+        }
+    }
+
+    double pyZeroValue= ( mW*mW*pxlep + 2*pxlep*pylep*zeroValue);
+    double delta2ZeroValue= (zeroValue-metpx)*(zeroValue-metpx) + (pyZeroValue-metpy)*(pyZeroValue-metpy);
+
+    if(deltaMin<14000*14000)
+    {
+        // else std::cout << " test " << std::endl;
+
+        if(delta2ZeroValue < deltaMin)
+        {
+            deltaMin = delta2ZeroValue;
+            minPx=zeroValue;
+            minPy=pyZeroValue;
+        }
+
+        // std::cout<<" MtW2 from min py and min px "<< sqrt((minPy*minPy+minPx*minPx))*ptlep*2 -2*(pxlep*minPx + pylep*minPy) <<std::endl;
+        /// ////Y part
+
+        double mu_Minimum = (mW*mW)/2 + minPx*pxlep + minPy*pylep;
+        double a_Minimum = (mu_Minimum*lepton.getPz())/(lepton.getE()*lepton.getE() - lepton.getPz()*lepton.getPz());
+        pznu = a_Minimum;
+
+        if(!useMetForNegativeSolutions_)
+        {
+            double Enu = sqrt(minPx*minPx+minPy*minPy + pznu*pznu);
+            p4nu_rec.setXYZ(minPx, minPy, pznu);
+            p4nu_rec.setE(Enu);
+        }
+        else
+        {
+            pznu = a;
+            double Enu = sqrt(metpx*metpx+metpy*metpy + pznu*pznu);
+            p4nu_rec.setXYZ(metpx, metpy, pznu);
+            p4nu_rec.setE(Enu);
+        }
+        return true;
+    }
+    return false;
+}
+
+#endif
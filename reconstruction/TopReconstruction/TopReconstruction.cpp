@@ -0,0 +1,382 @@
+#include "pxl/hep.hh"
+#include "pxl/core.hh"
+#include "pxl/core/macros.hh"
+#include "pxl/core/PluginManager.hh"
+#include "pxl/modules/Module.hh"
+#include "pxl/modules/ModuleFactory.hh"
+
+#include "EventViewIndex.hpp"
+
+#include <cmath>
+
+static pxl::Logger logger("TopReconstruction");
+
+/*
+* Reconstruction of the leptonic top quark decay t -> b W -> b l nu from the
+* neutrinos created by NeutrinoPz. For each neutrino both pz solutions of the
+* W mass constraint are tried (only the stored one for complex solutions)
+* together with every b-jet candidate. The W and top masses are computed
+* from the components, combinations outside the mass windows are pruned
+* and the remaining ones are ranked by
+*
+*   chi2 = ((mW-mW0)/sigmaW)^2 + ((mt-mt0)/sigmat)^2
+*
+* Only the best combination is built as four-vectors and written as a top
+* particle with the W as daughter; lepton and neutrino are linked to the W,
+* the b-jet to the top. The jets are prepared once per event view, so the
+* effort grows linearly with the number of jets.
+*/
+class TopReconstruction : public pxl::Module
+{
+    private:
+    pxl::Source* _output;
+
+    std::string _inputEventViewName;
+    EventViewIndex _eventViewIndex;
+    std::string _leptonName;
+    std::string _neutrinoName;
+    std::string _jetNames;
+    std::string _wName;
+    std::string _topName;
+
+    double _wMass;
+    double _wMassResolution;
+    double _wMassWindow;
+    double _topMass;
+    double _topMassResolution;
+    double _topMassWindow;
+
+    //the ',' separated jet names
+    std::vector<std::string> _jetNameList;
+
+    std::vector<pxl::Particle*> _leptons;
+    std::vector<pxl::Particle*> _neutrinos;
+    std::vector<pxl::Particle*> _jets;
+    //jet components of the current event view
+    std::vector<double> _jetPx;
+    std::vector<double> _jetPy;
+    std::vector<double> _jetPz;
+    std::vector<double> _jetE;
+    std::vector<double> _jetMass2;
+
+    struct Combination
+    {
+        double chi2;
+        pxl::Particle* lepton;
+        pxl::Particle* neutrino;
+        double pz;
+        unsigned jet;
+    };
+
+    public:
+    TopReconstruction() :
+        Module(),
+        _inputEventViewName("Reconstructed"),
+        _leptonName("TightMuon"),
+        _neutrinoName("Neutrino"),
+        _jetNames("SelectedBJet"),
+        _wName("W"),
+        _topName("Top"),
+        _wMass(80.38),
+        _wMassResolution(10.0),
+        _wMassWindow(40.0),
+        _topMass(172.5),
+        _topMassResolution(20.0),
+        _topMassWindow(100.0)
+    {
+        addSink("input", "Input");
+        _output = addSource("output", "output");
+
+        addOption("event view","name of the event view",_inputEventViewName);
+        addOption("lepton name","name of the lepton",_leptonName);
+        addOption("neutrino name","name of the neutrinos created by NeutrinoPz",_neutrinoName);
+        addOption("jet names","',' separated names of the b-jet candidates",_jetNames);
+        addOption("w name","name of the reconstructed W",_wName);
+        addOption("top name","name of the reconstructed top quark",_topName);
+        addOption("w mass","W mass used in the chi2",_wMass);
+        addOption("w mass resolution","W mass resolution used in the chi2",_wMassResolution);
+        addOption("w mass window","combinations with |mW-w mass| above the window are rejected",_wMassWindow);
+        addOption("top mass","top mass used in the chi2",_topMass);
+        addOption("top mass resolution","top mass resolution used in the chi2",_topMassResolution);
+        addOption("top mass window","combinations with |mt-top mass| above the window are rejected",_topMassWindow);
+    }
+
+    ~TopReconstruction()
+    {
+    }
+
+    // every Module needs a unique type
+    static const std::string &getStaticType()
+    {
+        static std::string type ("TopReconstruction");
+        return type;
+    }
+
+    // static and dynamic methods are needed
+    const std::string &getType() const
+    {
+        return getStaticType();
+    }
+
+    bool isRunnable() const
+    {
+        // this module does not provide events, so return false
+        return false;
+    }
+
+    void initialize() throw (std::runtime_error)
+    {
+    }
+
+    void beginJob() throw (std::runtime_error)
+    {
+        getOption("event view",_inputEventViewName);
+        getOption("lepton name",_leptonName);
+        getOption("neutrino name",_neutrinoName);
+        getOption("jet names",_jetNames);
+        getOption("w name",_wName);
+        getOption("top name",_topName);
+        getOption("w mass",_wMass);
+        getOption("w mass resolution",_wMassResolution);
+        getOption("w mass window",_wMassWindow);
+        getOption("top mass",_topMass);
+        getOption("top mass resolution",_topMassResolution);
+        getOption("top mass window",_topMassWindow);
+
+        if (_wMassResolution<=0 || _topMassResolution<=0)
+        {
+            throw std::runtime_error("mass resolutions need to be positive");
+        }
+
+        _jetNameList.clear();
+        size_t begin = 0;
+        while (begin<=_jetNames.size())
+        {
+            size_t end = _jetNames.find(',',begin);
+            if (end==std::string::npos)
+            {
+                end = _jetNames.size();
+            }
+            const std::string name = _jetNames.substr(begin,end-begin);
+            begin = end+1;
+            const size_t first = name.find_first_not_of(" \t");
+            if (first!=std::string::npos)
+            {
+                _jetNameList.push_back(name.substr(first,name.find_last_not_of(" \t")-first+1));
+            }
+        }
+    }
+
+    void endJob()
+    {
+    }
+
+    bool isJet(const std::string& name) const
+    {
+        for (unsigned iname=0; iname<_jetNameList.size(); ++iname)
+        {
+            if (_jetNameList[iname]==name)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //lepton the neutrino was solved for, the first lepton if the neutrino is not linked
+    pxl::Particle* getLepton(pxl::Particle* neutrino) const
+    {
+        std::vector<pxl::Particle*> mothers;
+        neutrino->getMotherRelations().getObjectsOfType(mothers);
+        for (unsigned imother=0; imother<mothers.size(); ++imother)
+        {
+            if (mothers[imother]->getName()==_leptonName)
+            {
+                return mothers[imother];
+            }
+        }
+        return _leptons.empty() ? 0 : _leptons[0];
+    }
+
+    //both solutions of the W mass constraint for real solutions, the stored pz otherwise
+    unsigned getPzSolutions(const pxl::Particle* lepton, const pxl::Particle* neutrino, double* pz) const
+    {
+        pz[0] = neutrino->getPz();
+        if (!neutrino->hasUserRecord("realsolution") || !neutrino->getUserRecord("realsolution").toBool())
+        {
+            return 1;
+        }
+        const double mW = neutrino->hasUserRecord("wMass") ? neutrino->getUserRecord("wMass").toDouble() : _wMass;
+        const double metpx = neutrino->getPx();
+        const double metpy = neutrino->getPy();
+        const double E2 = lepton->getE()*lepton->getE();
+        const double denominator = E2 - lepton->getPz()*lepton->getPz();
+        const double mu = (mW*mW)/2 + metpx*lepton->getPx() + metpy*lepton->getPy();
+        const double a = (mu*lepton->getPz())/denominator;
+        const double b = (E2*(metpx*metpx + metpy*metpy) - mu*mu)/denominator;
+        const double radicand = a*a-b;
+        if (!(radicand>0))
+        {
+            return 1;
+        }
+        const double root = std::sqrt(radicand);
+        pz[0] = a + root;
+        pz[1] = a - root;
+        return 2;
+    }
+
+    void reconstruct(pxl::EventView* eventView)
+    {
+        _jetPx.resize(_jets.size());
+        _jetPy.resize(_jets.size());
+        _jetPz.resize(_jets.size());
+        _jetE.resize(_jets.size());
+        _jetMass2.resize(_jets.size());
+        for (unsigned ijet=0; ijet<_jets.size(); ++ijet)
+        {
+            const pxl::LorentzVector& jet = _jets[ijet]->getVector();
+            _jetPx[ijet] = jet.getPx();
+            _jetPy[ijet] = jet.getPy();
+            _jetPz[ijet] = jet.getPz();
+            _jetE[ijet] = jet.getE();
+            _jetMass2[ijet] = _jetE[ijet]*_jetE[ijet] - _jetPx[ijet]*_jetPx[ijet] - _jetPy[ijet]*_jetPy[ijet] - _jetPz[ijet]*_jetPz[ijet];
+        }
+
+        Combination best = {0,0,0,0,0};
+        unsigned numCombinations = 0;
+        for (unsigned ineutrino=0; ineutrino<_neutrinos.size(); ++ineutrino)
+        {
+            pxl::Particle* neutrino = _neutrinos[ineutrino];
+            pxl::Particle* lepton = getLepton(neutrino);
+            if (!lepton)
+            {
+                continue;
+            }
+            double pzSolutions[2];
+            const unsigned numSolutions = getPzSolutions(lepton,neutrino,pzSolutions);
+            for (unsigned isolution=0; isolution<numSolutions; ++isolution)
+            {
+                const double nuPx = neutrino->getPx();
+                const double nuPy = neutrino->getPy();
+                const double nuPz = pzSolutions[isolution];
+                const double nuE = std::sqrt(nuPx*nuPx + nuPy*nuPy + nuPz*nuPz);
+                const double wPx = lepton->getPx() + nuPx;
+                const double wPy = lepton->getPy() + nuPy;
+                const double wPz = lepton->getPz() + nuPz;
+                const double wE = lepton->getE() + nuE;
+                const double wMass2 = wE*wE - wPx*wPx - wPy*wPy - wPz*wPz;
+                const double wMass = std::sqrt(wMass2>0 ? wMass2 : 0);
+                if (std::fabs(wMass-_wMass)>_wMassWindow)
+                {
+                    continue;
+                }
+                const double wChi2 = (wMass-_wMass)*(wMass-_wMass)/(_wMassResolution*_wMassResolution);
+                for (unsigned ijet=0; ijet<_jets.size(); ++ijet)
+                {
+                    //m_t^2 = m_W^2 + m_b^2 + 2 (E_W E_b - p_W.p_b)
+                    const double topMass2 = wMass2 + _jetMass2[ijet] + 2*(wE*_jetE[ijet] - wPx*_jetPx[ijet] - wPy*_jetPy[ijet] - wPz*_jetPz[ijet]);
+                    const double topMass = std::sqrt(topMass2>0 ? topMass2 : 0);
+                    if (std::fabs(topMass-_topMass)>_topMassWindow)
+                    {
+                        continue;
+                    }
+                    ++numCombinations;
+                    const double chi2 = wChi2 + (topMass-_topMass)*(topMass-_topMass)/(_topMassResolution*_topMassResolution);
+                    if (best.lepton==0 || chi2<best.chi2)
+                    {
+                        Combination combination = {chi2,lepton,neutrino,nuPz,ijet};
+                        best = combination;
+                    }
+                }
+            }
+        }
+        if (best.lepton==0)
+        {
+            return;
+        }
+
+        const double nuPx = best.neutrino->getPx();
+        const double nuPy = best.neutrino->getPy();
+        pxl::LorentzVector neutrinoVector;
+        neutrinoVector.setXYZ(nuPx,nuPy,best.pz);
+        neutrinoVector.setE(std::sqrt(nuPx*nuPx + nuPy*nuPy + best.pz*best.pz));
+
+        pxl::Particle* w = eventView->create<pxl::Particle>();
+        w->setName(_wName);
+        w->setP4(best.lepton->getVector()+neutrinoVector);
+        w->setCharge(best.lepton->getCharge());
+        w->linkDaughter(best.lepton);
+        w->linkDaughter(best.neutrino);
+        w->setUserRecord("neutrinoPz",best.pz);
+
+        pxl::Particle* top = eventView->create<pxl::Particle>();
+        top->setName(_topName);
+        top->setP4(w->getVector()+_jets[best.jet]->getVector());
+        top->setCharge(best.lepton->getCharge()*2.0/3.0);
+        top->linkDaughter(w);
+        top->linkDaughter(_jets[best.jet]);
+        top->setUserRecord("chi2",best.chi2);
+        top->setUserRecord("numCombinations",numCombinations);
+    }
+
+    bool analyse(pxl::Sink *sink) throw (std::runtime_error)
+    {
+        try
+        {
+            pxl::Event *event  = dynamic_cast<pxl::Event *> (sink->get());
+            if (event)
+            {
+                _eventViewIndex.build(event);
+                const std::vector<pxl::EventView*>& eventViews = _eventViewIndex.get(_inputEventViewName);
+                for (unsigned ieventView=0; ieventView<eventViews.size();++ieventView)
+                {
+                    pxl::EventView* eventView = eventViews[ieventView];
+                    std::vector<pxl::Particle*> particles;
+                    eventView->getObjectsOfType(particles);
+                    _leptons.clear();
+                    _neutrinos.clear();
+                    _jets.clear();
+                    for (unsigned iparticle=0; iparticle<particles.size();++iparticle)
+                    {
+                        pxl::Particle* particle = particles[iparticle];
+                        if (particle->getName()==_leptonName)
+                        {
+                            _leptons.push_back(particle);
+                        } else if (particle->getName()==_neutrinoName) {
+                            _neutrinos.push_back(particle);
+                        } else if (isJet(particle->getName())) {
+                            _jets.push_back(particle);
+                        }
+                    }
+                    reconstruct(eventView);
+                }
+
+                _output->setTargets(event);
+                return _output->processTargets();
+            }
+        }
+        catch(std::exception &e)
+        {
+            throw std::runtime_error(getName()+": "+e.what());
+        }
+        catch(...)
+        {
+            throw std::runtime_error(getName()+": unknown exception");
+        }
+
+        logger(pxl::LOG_LEVEL_ERROR , "Analysed event is not an pxl::Event !");
+        return false;
+    }
+
+    void shutdown() throw(std::runtime_error)
+    {
+    }
+
+    void destroy() throw (std::runtime_error)
+    {
+        delete this;
+    }
+};
+
+PXL_MODULE_INIT(TopReconstruction)
+PXL_PLUGIN_INIT
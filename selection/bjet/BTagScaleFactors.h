@@ -0,0 +1,319 @@
+#ifndef _BTAGSCALEFACTORS_H_
+#define _BTAGSCALEFACTORS_H_
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <cmath>
+#include <cstdlib>
+
+/*
+* Scale factors and MC tagging efficiencies of one working point and jet
+* flavour, binned in pt and |eta|. The bins are stored as flat arrays and
+* the bin index is found by counting the passed edges, which compiles to a
+* short branch-free loop for the handful of bins in a table. The bins may
+* not overlap and need to cover a rectangular pt-|eta| range; values
+* outside of it have no scale factor.
+*/
+class BTagScaleFactorTable
+{
+    public:
+    enum Variation
+    {
+        NOMINAL=0,
+        UP=1,
+        DOWN=2
+    };
+
+    private:
+    std::vector<double> _ptEdges;
+    std::vector<double> _etaEdges;
+    //per bin: nominal, up and down scale factor, efficiency
+    std::vector<double> _values;
+
+    static inline unsigned findBin(const std::vector<double>& edges, double value)
+    {
+        unsigned bin = 0;
+        for (unsigned iedge=1; iedge+1<edges.size(); ++iedge)
+        {
+            bin += value>=edges[iedge];
+        }
+        return bin;
+    }
+
+    public:
+    struct Bin
+    {
+        double ptMin, ptMax, etaMin, etaMax;
+        double sf, sfUp, sfDown, eff;
+    };
+
+    void build(const std::vector<Bin>& bins) throw (std::runtime_error)
+    {
+        _ptEdges.clear();
+        _etaEdges.clear();
+        for (unsigned ibin=0; ibin<bins.size(); ++ibin)
+        {
+            _ptEdges.push_back(bins[ibin].ptMin);
+            _ptEdges.push_back(bins[ibin].ptMax);
+            _etaEdges.push_back(bins[ibin].etaMin);
+            _etaEdges.push_back(bins[ibin].etaMax);
+        }
+        std::sort(_ptEdges.begin(),_ptEdges.end());
+        _ptEdges.erase(std::unique(_ptEdges.begin(),_ptEdges.end()),_ptEdges.end());
+        std::sort(_etaEdges.begin(),_etaEdges.end());
+        _etaEdges.erase(std::unique(_etaEdges.begin(),_etaEdges.end()),_etaEdges.end());
+
+        unsigned numPt = _ptEdges.size()-1;
+        unsigned numEta = _etaEdges.size()-1;
+        _values.assign(4*numPt*numEta,0.0);
+        std::vector<char> filled(numPt*numEta,0);
+        for (unsigned ibin=0; ibin<bins.size(); ++ibin)
+        {
+            const Bin& bin = bins[ibin];
+            unsigned ptBegin = std::lower_bound(_ptEdges.begin(),_ptEdges.end(),bin.ptMin)-_ptEdges.begin();
+            unsigned ptEnd = std::lower_bound(_ptEdges.begin(),_ptEdges.end(),bin.ptMax)-_ptEdges.begin();
+            unsigned etaBegin = std::lower_bound(_etaEdges.begin(),_etaEdges.end(),bin.etaMin)-_etaEdges.begin();
+            unsigned etaEnd = std::lower_bound(_etaEdges.begin(),_etaEdges.end(),bin.etaMax)-_etaEdges.begin();
+            //a wide bin of the file may span several cells of the grid
+            for (unsigned ipt=ptBegin; ipt<ptEnd; ++ipt)
+            {
+                for (unsigned ieta=etaBegin; ieta<etaEnd; ++ieta)
+                {
+                    if (filled[ipt*numEta+ieta])
+                    {
+                        std::ostringstream message;
+                        message<<"btag scale factor bin pt ["<<bin.ptMin<<","<<bin.ptMax<<"] |eta| ["<<bin.etaMin<<","<<bin.etaMax<<"] overlaps another bin";
+                        throw std::runtime_error(message.str());
+                    }
+                    filled[ipt*numEta+ieta] = 1;
+                    double* values = &_values[4*(ipt*numEta+ieta)];
+                    values[NOMINAL] = bin.sf;
+                    values[UP] = bin.sfUp;
+                    values[DOWN] = bin.sfDown;
+                    values[3] = bin.eff;
+                }
+            }
+        }
+        for (unsigned icell=0; icell<filled.size(); ++icell)
+        {
+            if (!filled[icell])
+            {
+                throw std::runtime_error("btag scale factor bins do not cover a rectangular pt-|eta| range");
+            }
+        }
+    }
+
+    bool empty() const
+    {
+        return _values.empty();
+    }
+
+    inline bool contains(double pt, double absEta) const
+    {
+        return pt>=_ptEdges.front() && pt<_ptEdges.back() && absEta>=_etaEdges.front() && absEta<_etaEdges.back();
+    }
+
+    //returns 0 if the values are outside of all bins
+    inline const double* lookup(double pt, double absEta) const
+    {
+        if (!contains(pt,absEta))
+        {
+            return 0;
+        }
+        unsigned numEta = _etaEdges.size()-1;
+        return &_values[4*(findBin(_ptEdges,pt)*numEta+findBin(_etaEdges,absEta))];
+    }
+
+    double getScaleFactor(double pt, double absEta, Variation variation) const throw (std::runtime_error)
+    {
+        return checkedLookup(pt,absEta)[variation];
+    }
+
+    double getEfficiency(double pt, double absEta) const throw (std::runtime_error)
+    {
+        return checkedLookup(pt,absEta)[3];
+    }
+
+    const double* checkedLookup(double pt, double absEta) const throw (std::runtime_error)
+    {
+        const double* values = lookup(pt,absEta);
+        if (!values)
+        {
+            std::ostringstream message;
+            message<<"no btag scale factor bin for pt "<<pt<<" and |eta| "<<absEta;
+            throw std::runtime_error(message.str());
+        }
+        return values;
+    }
+};
+
+/*
+* Scale factor tables of all working points read from a text file where
+* each non-empty line describes one bin
+*
+*   <working point> <b|c|light> <pt min> <pt max> <|eta| min> <|eta| max> <sf> <sf up> <sf down> <mc efficiency>
+*
+* and everything after a '#' is ignored. Overlapping bins are rejected; a
+* jet outside of all bins cannot be weighted, so the last bins should
+* extend to the largest pt and |eta| of the selected jets.
+*/
+class BTagScaleFactors
+{
+    public:
+    enum Flavour
+    {
+        B=0,
+        C=1,
+        LIGHT=2
+    };
+
+    private:
+    std::vector<std::string> _workingPoints;
+    //three tables per working point, indexed by flavour
+    std::vector<BTagScaleFactorTable> _tables;
+
+    public:
+    static inline Flavour getFlavour(int partonFlavour)
+    {
+        partonFlavour = std::abs(partonFlavour);
+        return partonFlavour==5 ? B : (partonFlavour==4 ? C : LIGHT);
+    }
+
+    void load(const std::string& fileName) throw (std::runtime_error)
+    {
+        std::ifstream ifs(fileName.c_str());
+        if (!ifs.is_open())
+        {
+            throw std::runtime_error("cannot open btag scale factor file '"+fileName+"'");
+        }
+        _workingPoints.clear();
+        std::vector<std::vector<BTagScaleFactorTable::Bin> > bins;
+        std::string line;
+        unsigned lineNumber = 0;
+        while (std::getline(ifs,line))
+        {
+            ++lineNumber;
+            std::istringstream stream(line.substr(0,line.find('#')));
+            std::string workingPoint;
+            std::string flavourName;
+            BTagScaleFactorTable::Bin bin;
+            if (!(stream>>workingPoint))
+            {
+                continue;
+            }
+            std::string rest;
+            if (!(stream>>flavourName>>bin.ptMin>>bin.ptMax>>bin.etaMin>>bin.etaMax>>bin.sf>>bin.sfUp>>bin.sfDown>>bin.eff) || (stream>>rest) || bin.ptMin>=bin.ptMax || bin.etaMin>=bin.etaMax)
+            {
+                std::ostringstream message;
+                message<<"btag scale factor file '"<<fileName<<"' line "<<lineNumber<<": expected '<working point> <b|c|light> <pt min> <pt max> <|eta| min> <|eta| max> <sf> <sf up> <sf down> <mc efficiency>'";
+                throw std::runtime_error(message.str());
+            }
+            Flavour flavour;
+            if (flavourName=="b")
+            {
+                flavour = B;
+            } else if (flavourName=="c") {
+                flavour = C;
+            } else if (flavourName=="light") {
+                flavour = LIGHT;
+            } else {
+                std::ostringstream message;
+                message<<"btag scale factor file '"<<fileName<<"' line "<<lineNumber<<": unknown flavour '"<<flavourName<<"'";
+                throw std::runtime_error(message.str());
+            }
+            unsigned index = std::find(_workingPoints.begin(),_workingPoints.end(),workingPoint)-_workingPoints.begin();
+            if (index==_workingPoints.size())
+            {
+                _workingPoints.push_back(workingPoint);
+                bins.resize(3*_workingPoints.size());
+            }
+            bins[3*index+flavour].push_back(bin);
+        }
+        _tables.assign(bins.size(),BTagScaleFactorTable());
+        for (unsigned itable=0; itable<bins.size(); ++itable)
+        {
+            if (bins[itable].size()>0)
+            {
+                try
+                {
+                    _tables[itable].build(bins[itable]);
+                }
+                catch (std::runtime_error& e)
+                {
+                    static const char* flavourNames[3] = {"b","c","light"};
+                    throw std::runtime_error("btag scale factor file '"+fileName+"', working point '"+_workingPoints[itable/3]+"', flavour "+flavourNames[itable%3]+": "+e.what());
+                }
+            }
+        }
+    }
+
+    //returns the three flavour tables of a working point
+    const BTagScaleFactorTable* get(const std::string& workingPoint) const throw (std::runtime_error)
+    {
+        unsigned index = std::find(_workingPoints.begin(),_workingPoints.end(),workingPoint)-_workingPoints.begin();
+        if (index==_workingPoints.size())
+        {
+            throw std::runtime_error("no btag scale factors for working point '"+workingPoint+"'");
+        }
+        for (unsigned iflavour=0; iflavour<3; ++iflavour)
+        {
+            if (_tables[3*index+iflavour].empty())
+            {
+                throw std::runtime_error("btag scale factors for working point '"+workingPoint+"' need b, c and light tables");
+            }
+        }
+        return &_tables[3*index];
+    }
+};
+
+/*
+* Event weight of the per-jet probability method
+*
+*   w = prod_tagged SF_i * prod_untagged (1-SF_i*eff_i)/(1-eff_i)
+*
+* accumulated jet by jet for the nominal, up and down scale factors.
+*/
+class BTagEventWeight
+{
+    private:
+    double _weights[3];
+
+    public:
+    BTagEventWeight()
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        _weights[0] = _weights[1] = _weights[2] = 1.0;
+    }
+
+    //returns false and leaves the weights unchanged if the jet is outside of all bins
+    inline bool addJet(const BTagScaleFactorTable& table, double pt, double absEta, bool tagged)
+    {
+        const double* values = table.lookup(pt,absEta);
+        if (!values)
+        {
+            return false;
+        }
+        double eff = values[3];
+        for (unsigned ivariation=0; ivariation<3; ++ivariation)
+        {
+            double sf = values[ivariation];
+            _weights[ivariation] *= tagged ? sf : (eff<1.0 ? (1.0-sf*eff)/(1.0-eff) : 1.0);
+        }
+        return true;
+    }
+
+    double getWeight(BTagScaleFactorTable::Variation variation=BTagScaleFactorTable::NOMINAL) const
+    {
+        return _weights[variation];
+    }
+};
+
+#endif
@@ -0,0 +1,191 @@
+#ifndef _BTAGGERREGISTRY_H_
+#define _BTAGGERREGISTRY_H_
+
+#include "pxl/hep.hh"
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <cstdint>
+
+//cut based working point on a discriminator stored as user record
+struct BTagWorkingPoint
+{
+    std::string name;
+    std::string discriminator;
+    double threshold;
+};
+
+/*
+* Known btagging working points. The built-in CSV working points are always
+* present; a tagger file can add new ones or recalibrate existing ones
+* without rebuilding the modules. Each non-empty line of the file reads
+*
+*   <name> <discriminator user record> <threshold>
+*
+* and everything after a '#' is ignored.
+*/
+class BTaggerRegistry
+{
+    private:
+    std::vector<BTagWorkingPoint> _workingPoints;
+
+    public:
+    BTaggerRegistry()
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        _workingPoints.clear();
+        add("CSVL","combinedSecondaryVertexBJetTags",0.244);
+        add("CSVM","combinedSecondaryVertexBJetTags",0.679);
+        add("CSVT","combinedSecondaryVertexBJetTags",0.898);
+    }
+
+    void add(const std::string& name, const std::string& discriminator, double threshold)
+    {
+        BTagWorkingPoint workingPoint;
+        workingPoint.name = name;
+        workingPoint.discriminator = discriminator;
+        workingPoint.threshold = threshold;
+        for (unsigned iworkingPoint=0; iworkingPoint<_workingPoints.size(); ++iworkingPoint)
+        {
+            if (_workingPoints[iworkingPoint].name==name)
+            {
+                _workingPoints[iworkingPoint] = workingPoint;
+                return;
+            }
+        }
+        _workingPoints.push_back(workingPoint);
+    }
+
+    void load(const std::string& fileName) throw (std::runtime_error)
+    {
+        std::ifstream ifs(fileName.c_str());
+        if (!ifs.is_open())
+        {
+            throw std::runtime_error("cannot open btagger file '"+fileName+"'");
+        }
+        std::string line;
+        unsigned lineNumber = 0;
+        while (std::getline(ifs,line))
+        {
+            ++lineNumber;
+            std::istringstream stream(line.substr(0,line.find('#')));
+            std::string name;
+            std::string discriminator;
+            double threshold;
+            if (!(stream>>name))
+            {
+                continue;
+            }
+            std::string rest;
+            if (!(stream>>discriminator>>threshold) || (stream>>rest))
+            {
+                std::ostringstream message;
+                message<<"btagger file '"<<fileName<<"' line "<<lineNumber<<": expected '<name> <discriminator> <threshold>'";
+                throw std::runtime_error(message.str());
+            }
+            add(name,discriminator,threshold);
+        }
+    }
+
+    const BTagWorkingPoint& get(const std::string& name) const throw (std::runtime_error)
+    {
+        for (unsigned iworkingPoint=0; iworkingPoint<_workingPoints.size(); ++iworkingPoint)
+        {
+            if (_workingPoints[iworkingPoint].name==name)
+            {
+                return _workingPoints[iworkingPoint];
+            }
+        }
+        std::string message("");
+        message+="specified btagging algorithm '";
+        message+=name;
+        message+="' not in database";
+        throw std::runtime_error(message);
+    }
+};
+
+/*
+* Evaluates a set of working points on a jet. Working points sharing a
+* discriminator are grouped so the user record is read once per jet and
+* compared against all its thresholds; bit i of the returned mask is set
+* if the jet passes the i-th working point given to setup().
+*/
+class BTagEvaluator
+{
+    private:
+    struct Discriminator
+    {
+        std::string key;
+        std::vector<double> thresholds;
+        std::vector<uint32_t> bits;
+    };
+
+    std::vector<Discriminator> _discriminators;
+    std::vector<std::string> _names;
+
+    public:
+    void setup(const BTaggerRegistry& registry, const std::vector<std::string>& names) throw (std::runtime_error)
+    {
+        if (names.size()>32)
+        {
+            throw std::runtime_error("at most 32 btagging working points can be evaluated at once");
+        }
+        _discriminators.clear();
+        _names = names;
+        for (unsigned iname=0; iname<names.size(); ++iname)
+        {
+            const BTagWorkingPoint& workingPoint = registry.get(names[iname]);
+            unsigned idiscriminator = 0;
+            while (idiscriminator<_discriminators.size() && _discriminators[idiscriminator].key!=workingPoint.discriminator)
+            {
+                ++idiscriminator;
+            }
+            if (idiscriminator==_discriminators.size())
+            {
+                _discriminators.push_back(Discriminator());
+                _discriminators.back().key = workingPoint.discriminator;
+            }
+            _discriminators[idiscriminator].thresholds.push_back(workingPoint.threshold);
+            _discriminators[idiscriminator].bits.push_back(1u<<iname);
+        }
+    }
+
+    unsigned size() const
+    {
+        return _names.size();
+    }
+
+    const std::string& getName(unsigned index) const
+    {
+        return _names[index];
+    }
+
+    inline uint32_t evaluate(pxl::Particle* particle) const throw (std::runtime_error)
+    {
+        uint32_t mask = 0;
+        for (unsigned idiscriminator=0; idiscriminator<_discriminators.size(); ++idiscriminator)
+        {
+            const Discriminator& discriminator = _discriminators[idiscriminator];
+            if (!particle->hasUserRecord(discriminator.key))
+            {
+                throw std::runtime_error("The following particle is missing the UR field '"+discriminator.key+"' to apply btagging\r\n"+particle->toString());
+            }
+            //keep the float precision of the stored discriminator
+            double value = particle->getUserRecord(discriminator.key).toFloat();
+            for (unsigned ithreshold=0; ithreshold<discriminator.thresholds.size(); ++ithreshold)
+            {
+                mask |= value>discriminator.thresholds[ithreshold] ? discriminator.bits[ithreshold] : 0;
+            }
+        }
+        return mask;
+    }
+};
+
+#endif
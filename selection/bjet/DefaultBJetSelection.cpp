@@ -7,55 +7,85 @@
 
 #include <vector>
 #include <string>
+#include <sstream>
+#include <cstdint>
+#include <algorithm>
 
-#include "BTaggerAlgorithm.h"
+#include "MultiplicityRouter.hpp"
+#include "BTaggerRegistry.h"
+#include "BTagScaleFactors.h"
+#include "EventViewIndex.hpp"
 
 static pxl::Logger logger("DefaultBJetSelection");
 
 class DefaultBJetSelection : public pxl::Module
 {
     private:
-    pxl::Source* _sourceSelected_0bjets;
-    pxl::Source* _sourceSelected_1bjets;
-    pxl::Source* _sourceSelected_2bjets;
-    pxl::Source* _sourceSelected_3bjets;
-    pxl::Source* _sourceSelected_4bjets;
-    pxl::Source* _sourceSelected_5bjets;
-    pxl::Source* _sourceSelected_6bjets;
-    pxl::Source* _sourceSelected_otherbjets;
     pxl::Source* _sourceVeto;
 
+    std::string _multiplicityBins;
+    MultiplicityRouter _router;
+
     std::string _inputJetName;
     std::string _inputEventViewName;
+    EventViewIndex _eventViewIndex;
     std::string _selectedJetName;
     
     std::string _btaggerAlgorithmName;
 
-    BTaggerAlgorithm* _btaggerAlgorithm;
+    std::string _btaggerFileName;
+
+    BTaggerRegistry _btaggerRegistry;
+    BTagEvaluator _btagEvaluator;
+
+    std::string _workingPointNames;
+    std::string _maskRecordName;
+    bool _writeWorkingPoints;
+    std::vector<std::string> _workingPointCountNames;
+    std::vector<int> _workingPointCounts;
+    uint32_t _primaryMask;
+
+    std::string _scaleFactorFileName;
+    std::string _flavourRecordName;
+    std::string _weightRecordName;
+    std::string _weightUpRecordName;
+    std::string _weightDownRecordName;
+    BTagScaleFactors _scaleFactors;
+    const BTagScaleFactorTable* _scaleFactorTables;
+    BTagEventWeight _eventWeight;
 
     public:
     DefaultBJetSelection() :
         Module(),
+        _multiplicityBins("0,1,2,3,4,5,6,>6"),
         _inputJetName("SelectedJet"),
         _inputEventViewName("Reconstructed"),
         _selectedJetName("SelectedBJet"),
-        _btaggerAlgorithmName("CSVT")
+        _btaggerAlgorithmName("CSVT"),
+        _btaggerFileName(""),
+        _workingPointNames(""),
+        _maskRecordName("btagMask"),
+        _writeWorkingPoints(false),
+        _primaryMask(1),
+        _scaleFactorFileName(""),
+        _flavourRecordName("partonFlavour"),
+        _weightRecordName("btagWeight"),
+        _scaleFactorTables(0)
     {
         addSink("input", "Input");
-        _sourceSelected_otherbjets = addSource(">6 bjets", ">6 bjets");
-        _sourceSelected_6bjets = addSource("6 bjets", "6 bjets");
-        _sourceSelected_5bjets = addSource("5 bjets", "5 bjets");
-        _sourceSelected_4bjets = addSource("4 bjets", "4 bjets");
-        _sourceSelected_3bjets = addSource("3 bjets", "3 bjets");
-        _sourceSelected_2bjets = addSource("2 bjets", "2 bjets");
-        _sourceSelected_1bjets = addSource("1 bjets", "1 bjets");
-        _sourceSelected_0bjets = addSource("0 bjets", "0 bjets");
 
         addOption("event view","name of the event view where jets are selected",_inputEventViewName);
+        addOption("multiplicity bins","',' separated bins of the number of selected bjets routed to an own source, e.g. '0,1,2-3,>=4'; events outside the bins are dropped",_multiplicityBins);
         addOption("input jet name","name of particles to consider for selection",_inputJetName);
         addOption("name of selected bjets","",_selectedJetName);
         
         addOption("algorithm","used btagging algorithm",_btaggerAlgorithmName);
+        addOption("btagger file","optional file with lines '<name> <discriminator> <threshold>' adding or recalibrating algorithms",_btaggerFileName,pxl::OptionDescription::USAGE_FILE_OPEN);
+        addOption("working points","',' separated list of additional btagging algorithms evaluated in the same pass, bit i of the mask is the i-th entry",_workingPointNames);
+        addOption("mask record","name of the per jet bitmask of passed working points",_maskRecordName);
+        addOption("scale factor file","optional file with lines '<working point> <b|c|light> <pt min> <pt max> <|eta| min> <|eta| max> <sf> <sf up> <sf down> <mc efficiency>'; enables the event weight",_scaleFactorFileName,pxl::OptionDescription::USAGE_FILE_OPEN);
+        addOption("flavour record","user record of the jets holding the parton flavour",_flavourRecordName);
+        addOption("weight record","name of the btag event weight; the variations get the suffixes '_up' and '_down'",_weightRecordName);
     }
 
     ~DefaultBJetSelection()
@@ -83,6 +113,9 @@ class DefaultBJetSelection : public pxl::Module
 
     void initialize() throw (std::runtime_error)
     {
+        getOption("multiplicity bins",_multiplicityBins);
+        _router.parse(_multiplicityBins,"bjets");
+        _router.addSources(this);
     }
 
     void beginJob() throw (std::runtime_error)
@@ -91,27 +124,64 @@ class DefaultBJetSelection : public pxl::Module
         getOption("input jet name",_inputJetName);
         getOption("name of selected bjets",_selectedJetName);
         getOption("algorithm",_btaggerAlgorithmName);
+        getOption("btagger file",_btaggerFileName);
+        getOption("working points",_workingPointNames);
+        getOption("mask record",_maskRecordName);
+        getOption("scale factor file",_scaleFactorFileName);
+        getOption("flavour record",_flavourRecordName);
+        getOption("weight record",_weightRecordName);
 
-        if (BTaggerDataBase.find(_btaggerAlgorithmName)!=BTaggerDataBase.end())
+        _btaggerRegistry.reset();
+        if (_btaggerFileName.size()>0)
         {
-            _btaggerAlgorithm = BTaggerDataBase.at(_btaggerAlgorithmName);
-        } else {
-            std::string message("");
-            message+="specified btagging algorithm '";
-            message+=_btaggerAlgorithmName;
-            message+="' not in database";
-            throw std::runtime_error(message);
+            _btaggerRegistry.load(_btaggerFileName);
+        }
+        setupWorkingPoints();
+
+        _scaleFactorTables = 0;
+        if (_scaleFactorFileName.size()>0)
+        {
+            _scaleFactors.load(_scaleFactorFileName);
+            _scaleFactorTables = _scaleFactors.get(_btaggerAlgorithmName);
+            _weightUpRecordName = _weightRecordName+"_up";
+            _weightDownRecordName = _weightRecordName+"_down";
         }
     }
 
-    bool passSelection(pxl::Particle* particle) throw (std::runtime_error)
+    void setupWorkingPoints() throw (std::runtime_error)
     {
-        if (_btaggerAlgorithm->testBtagged(particle))
+        std::vector<std::string> names;
+        std::string workingPoints(_workingPointNames);
+        for (unsigned ichar=0; ichar<workingPoints.size(); ++ichar)
+        {
+            if (workingPoints[ichar]==',' || workingPoints[ichar]==';')
+            {
+                workingPoints[ichar]=' ';
+            }
+        }
+        std::istringstream stream(workingPoints);
+        std::string name;
+        while (stream>>name)
         {
-            //-------------------------------------------------------------------------TODO: apply SF
-            return true;
+            names.push_back(name);
         }
-        return false;
+        //without additional working points no mask and no extra counts are written
+        _writeWorkingPoints = names.size()>0;
+        std::vector<std::string>::const_iterator primary = std::find(names.begin(),names.end(),_btaggerAlgorithmName);
+        if (primary==names.end())
+        {
+            names.push_back(_btaggerAlgorithmName);
+            primary = names.end()-1;
+        }
+        _primaryMask = 1u<<(primary-names.begin());
+        _btagEvaluator.setup(_btaggerRegistry,names);
+
+        _workingPointCountNames.clear();
+        for (unsigned iname=0; iname<names.size(); ++iname)
+        {
+            _workingPointCountNames.push_back("numBJets_"+names[iname]);
+        }
+        _workingPointCounts.assign(_writeWorkingPoints ? names.size() : 0,0);
     }
 
     bool analyse(pxl::Sink *sink) throw (std::runtime_error)
@@ -122,59 +192,61 @@ class DefaultBJetSelection : public pxl::Module
             if (event)
             {
                 int numBJets=0;
-                std::vector<pxl::EventView*> eventViews;
-                event->getObjectsOfType(eventViews);
+                _eventViewIndex.build(event);
+                const std::vector<pxl::EventView*>& eventViews = _eventViewIndex.get(_inputEventViewName);
                 for (unsigned ieventView=0; ieventView<eventViews.size();++ieventView)
                 {
                     pxl::EventView* eventView = eventViews[ieventView];
-                    if (eventView->getName()==_inputEventViewName)
+                    std::vector<pxl::Particle*> particles;
+                    eventView->getObjectsOfType(particles);
+                    _workingPointCounts.assign(_workingPointCounts.size(),0);
+                    _eventWeight.reset();
+                    for (unsigned iparticle=0; iparticle<particles.size();++iparticle)
                     {
-                        std::vector<pxl::Particle*> particles;
-                        eventView->getObjectsOfType(particles);
-                        for (unsigned iparticle=0; iparticle<particles.size();++iparticle)
+                        pxl::Particle* particle = particles[iparticle];
+                        if (particle->getName()==_inputJetName)
                         {
-                            pxl::Particle* particle = particles[iparticle];
-                            if (particle->getName()==_inputJetName)
+                            uint32_t mask = _btagEvaluator.evaluate(particle);
+                            if (_writeWorkingPoints)
+                            {
+                                particle->setUserRecord(_maskRecordName,mask);
+                                for (unsigned iworkingPoint=0; iworkingPoint<_workingPointCounts.size(); ++iworkingPoint)
+                                {
+                                    _workingPointCounts[iworkingPoint]+=(mask>>iworkingPoint)&1;
+                                }
+                            }
+                            if (_scaleFactorTables)
                             {
-                                if (passSelection(particle))
+                                if (!particle->hasUserRecord(_flavourRecordName))
+                                {
+                                    throw std::runtime_error("The following particle is missing the UR field '"+_flavourRecordName+"' to apply btag scale factors\r\n"+particle->toString());
+                                }
+                                BTagScaleFactors::Flavour flavour = BTagScaleFactors::getFlavour(particle->getUserRecord(_flavourRecordName).toInt32());
+                                if (!_eventWeight.addJet(_scaleFactorTables[flavour],particle->getPt(),std::fabs(particle->getEta()),(mask&_primaryMask)!=0))
                                 {
-                                    particle->setName(_selectedJetName);
-                                    ++numBJets;
+                                    throw std::runtime_error("The following particle is outside of all btag scale factor bins, extend the bins of '"+_scaleFactorFileName+"'\r\n"+particle->toString());
                                 }
                             }
+                            if (mask&_primaryMask)
+                            {
+                                particle->setName(_selectedJetName);
+                                ++numBJets;
+                            }
                         }
-                        eventView->setUserRecord("numBJets",numBJets);
+                    }
+                    eventView->setUserRecord("numBJets",numBJets);
+                    if (_scaleFactorTables)
+                    {
+                        eventView->setUserRecord(_weightRecordName,_eventWeight.getWeight(BTagScaleFactorTable::NOMINAL));
+                        eventView->setUserRecord(_weightUpRecordName,_eventWeight.getWeight(BTagScaleFactorTable::UP));
+                        eventView->setUserRecord(_weightDownRecordName,_eventWeight.getWeight(BTagScaleFactorTable::DOWN));
+                    }
+                    for (unsigned iworkingPoint=0; iworkingPoint<_workingPointCounts.size(); ++iworkingPoint)
+                    {
+                        eventView->setUserRecord(_workingPointCountNames[iworkingPoint],_workingPointCounts[iworkingPoint]);
                     }
                 }
-                pxl::Source* sourceSelected=0;
-                switch (numBJets)
-                {
-                    case 0:
-                        sourceSelected = _sourceSelected_0bjets;
-                        break;
-                    case 1:
-                        sourceSelected = _sourceSelected_1bjets;
-                        break;
-                    case 2:
-                        sourceSelected = _sourceSelected_2bjets;
-                        break;
-                    case 3:
-                        sourceSelected = _sourceSelected_3bjets;
-                        break;
-                    case 4:
-                        sourceSelected = _sourceSelected_4bjets;
-                        break;
-                    case 5:
-                        sourceSelected = _sourceSelected_5bjets;
-                        break;
-                    case 6:
-                        sourceSelected = _sourceSelected_6bjets;
-                        break;
-                    default:
-                        sourceSelected = _sourceSelected_otherbjets;
-                }
-                sourceSelected->setTargets(event);
-                return sourceSelected->processTargets();
+                return _router.process(numBJets,event);
             }
         }
         catch(std::exception &e)
@@ -0,0 +1,391 @@
+#include "pxl/hep.hh"
+#include "pxl/core.hh"
+#include "pxl/core/macros.hh"
+#include "pxl/core/PluginManager.hh"
+#include "pxl/modules/Module.hh"
+#include "pxl/modules/ModuleFactory.hh"
+
+#include <vector>
+#include <string>
+
+#include "CutEngine.hpp"
+#include "MultiplicityRouter.hpp"
+#include "CandidateCleaner.hpp"
+#include "ElectronTriggerPreselection.hpp"
+#include "BTaggerRegistry.h"
+#include "EventViewIndex.hpp"
+
+static pxl::Logger logger("DefaultObjectSelection");
+
+/*
+* Runs the muon, electron, jet and bjet selection of the default chain in
+* a single traversal of the event view. The events are routed like the chain
+* "DefaultMuonSelection -> DefaultElectronSelection -> DefaultJetSelection ->
+* DefaultBJetSelection" connected through the required tight lepton counts,
+* with a bjet selection behind each jet bin source. The sources differ from
+* the ones of the chain:
+*  - a loose muon or electron sends the event to the one 'veto' source
+*    instead of the veto source of the respective lepton selection
+*  - an event with another number of tight leptons than required goes to
+*    'fail' instead of the other multiplicity sources of the lepton
+*    selections
+*  - the selected events go to one source per pair of a jet and a bjet bin,
+*    e.g. "4 jets, 2 bjets"; with empty jet bins to one source per bjet bin
+*    like a single bjet selection behind all jet bins
+*/
+class DefaultObjectSelection : public pxl::Module
+{
+    private:
+    enum Category
+    {
+        MUON,
+        ELECTRON,
+        JET
+    };
+
+    pxl::Source* _sourceVeto;
+
+    std::string _jetMultiplicityBins;
+    MultiplicityRouter _jetRouter;
+    std::string _multiplicityBins;
+    MultiplicityRouter _router;
+    pxl::Source* _sourceFail;
+
+    std::string _inputEventViewName;
+    EventViewIndex _eventViewIndex;
+    bool _cleanEvent;
+    std::string _cleanMode;
+    std::string _droppedName;
+    CandidateCleaner _cleaner;
+
+    std::string _inputMuonName;
+    std::string _tightMuonName;
+    std::string _looseMuonName;
+    std::string _muonTightCuts;
+    std::string _muonLooseCuts;
+    int64_t _numTightMuons;
+
+    std::string _inputElectronName;
+    std::string _tightElectronName;
+    std::string _looseElectronName;
+    std::string _electronTightCuts;
+    std::string _electronLooseCuts;
+    int64_t _numTightElectrons;
+
+    std::string _inputJetName;
+    std::string _selectedJetName;
+    std::string _jetCuts;
+
+    std::string _selectedBJetName;
+    std::string _btaggerAlgorithmName;
+    std::string _btaggerFileName;
+    BTaggerRegistry _btaggerRegistry;
+    BTagEvaluator _btagEvaluator;
+
+    CutEngine _muonTightCutEngine;
+    CutEngine _muonLooseCutEngine;
+    CutEngine _electronTightCutEngine;
+    CutEngine _electronLooseCutEngine;
+    std::string _electronTriggerPreselectionBins;
+    ElectronTriggerPreselection _electronTriggerPreselection;
+    CutEngine _jetCutEngine;
+
+    std::vector<pxl::Particle*> _candidates[3];
+    //jets of each view, selected once the lepton counts of all views are known
+    std::vector<std::vector<pxl::Particle*> > _viewJets;
+
+    public:
+    DefaultObjectSelection() :
+        Module(),
+        _jetMultiplicityBins("0,1,2,3,4,5,6,>6"),
+        _multiplicityBins("0,1,2,3,4,5,6,>6"),
+        _inputEventViewName("Reconstructed"),
+        _cleanEvent(true),
+        _cleanMode("remove"),
+        _droppedName("Dropped"),
+        _inputMuonName("Muon"),
+        _tightMuonName("TightMuon"),
+        _looseMuonName("LooseMuon"),
+        _muonTightCuts("pt > 26.0; abs(eta) < 2.1; isPFMuon; isGlobalMuon; chi2 < 10.0; numberOfValidMuonHits > 0; numberOfMatchedStations > 1; abs(dxy) < 0.2; abs(dz) < 0.5; numberOfValidPixelHits > 0; trackerLayersWithMeasurement > 5; relIso < 0.12"),
+        _muonLooseCuts("pt > 10.0; abs(eta) < 2.5; relIso < 0.2; abs(dxy) < 0.2; abs(dz) < 0.5"),
+        _numTightMuons(1),
+        _inputElectronName("Electron"),
+        _tightElectronName("TightElectron"),
+        _looseElectronName("LooseElectron"),
+        _electronTightCuts("pt > 30.0; abs(eta) > 2.5; isInEB-EE; passConversionVeto; mva > 0.5; triggerPreselection(); numberOfHits <= 0; relIso < 0.1"),
+        _electronLooseCuts("pt > 10.0"),
+        _electronTriggerPreselectionBins(ElectronTriggerPreselection::getDefaultBins()),
+        _numTightElectrons(0),
+        _inputJetName("Jet"),
+        _selectedJetName("SelectedJet"),
+        _jetCuts("pt > 30.0; numberOfDaughters > 1; neutralEmEnergyFraction < 0.99; abs(eta) < 2.4 -> chargedEmEnergyFraction < 0.99; abs(eta) < 2.4 -> chargedHadronEnergyFraction > 0.0; abs(eta) < 2.4 -> chargedMultiplicity > 0"),
+        _selectedBJetName("SelectedBJet"),
+        _btaggerAlgorithmName("CSVT"),
+        _btaggerFileName("")
+    {
+        addSink("input", "Input");
+        _sourceVeto = addSource("veto", "veto");
+        _sourceFail = addSource("fail", "fail");
+
+        addOption("event view","name of the event view where objects are selected",_inputEventViewName);
+        addOption("jet multiplicity bins","',' separated bins of the number of selected jets, e.g. '0,1,2-3,>=4'; empty to route on the bjets only",_jetMultiplicityBins);
+        addOption("multiplicity bins","',' separated bins of the number of selected bjets; each pair of a jet and a bjet bin is routed to an own source, events outside the bins are dropped",_multiplicityBins);
+        addOption("clean event","this option will clean the event of all objects falling the selection",_cleanEvent);
+        addOption("clean mode","'remove' deletes the rejected objects from the view at a linear search per object, 'mark' renames them to the dropped name",_cleanMode);
+        addOption("dropped name","name given to rejected objects in 'mark' mode",_droppedName);
+
+        addOption("input muon name","name of muons to consider for selection",_inputMuonName);
+        addOption("name of selected tight muons","",_tightMuonName);
+        addOption("name of selected loose muons","",_looseMuonName);
+        addOption("muon tight cuts","';' separated list of cuts for tight muons",_muonTightCuts);
+        addOption("muon loose cuts","';' separated list of cuts for loose muons",_muonLooseCuts);
+        addOption("tight muons","required number of tight muons, events with other numbers go to 'fail'",_numTightMuons);
+
+        addOption("input electron name","name of electrons to consider for selection",_inputElectronName);
+        addOption("name of selected tight electrons","",_tightElectronName);
+        addOption("name of selected loose electrons","",_looseElectronName);
+        addOption("electron tight cuts","';' separated list of cuts for tight electrons, triggerPreselection() applies the trigger emulation",_electronTightCuts);
+        addOption("electron loose cuts","';' separated list of cuts for loose electrons",_electronLooseCuts);
+        addOption("electron trigger preselection bins","';' separated bins '<max |eta|> <sigmaIetaIeta> <hadronicOverEm> <track iso> <ecal iso> <hcal iso> <max lost hits>' of triggerPreselection() in |superClusterEta| with increasing edges, the last may be 'inf'; isolations relative to pt",_electronTriggerPreselectionBins);
+        addOption("tight electrons","required number of tight electrons, events with other numbers go to 'fail'",_numTightElectrons);
+
+        addOption("input jet name","name of jets to consider for selection",_inputJetName);
+        addOption("name of selected jets","",_selectedJetName);
+        addOption("jet cuts","';' separated list of jet cuts",_jetCuts);
+
+        addOption("name of selected bjets","",_selectedBJetName);
+        addOption("algorithm","used btagging algorithm",_btaggerAlgorithmName);
+        addOption("btagger file","optional file with lines '<name> <discriminator> <threshold>' adding or recalibrating algorithms",_btaggerFileName,pxl::OptionDescription::USAGE_FILE_OPEN);
+
+        _electronTightCutEngine.addPredicate("triggerPreselection",std::ref(_electronTriggerPreselection));
+        _electronLooseCutEngine.addPredicate("triggerPreselection",std::ref(_electronTriggerPreselection));
+    }
+
+    ~DefaultObjectSelection()
+    {
+    }
+
+    // every Module needs a unique type
+    static const std::string &getStaticType()
+    {
+        static std::string type ("DefaultObjectSelection");
+        return type;
+    }
+
+    // static and dynamic methods are needed
+    const std::string &getType() const
+    {
+        return getStaticType();
+    }
+
+    bool isRunnable() const
+    {
+        // this module does not provide events, so return false
+        return false;
+    }
+
+    void initialize() throw (std::runtime_error)
+    {
+        getOption("jet multiplicity bins",_jetMultiplicityBins);
+        getOption("multiplicity bins",_multiplicityBins);
+        _router.parse(_multiplicityBins,"bjets");
+        if (_jetMultiplicityBins.find_first_not_of(" \t")==std::string::npos)
+        {
+            _router.addSources(this);
+        }
+        else
+        {
+            _jetRouter.parse(_jetMultiplicityBins,"jets");
+            _router.addSources(this,_jetRouter);
+        }
+    }
+
+    void beginJob() throw (std::runtime_error)
+    {
+        getOption("event view",_inputEventViewName);
+        getOption("clean event",_cleanEvent);
+        getOption("clean mode",_cleanMode);
+        getOption("dropped name",_droppedName);
+
+        getOption("input muon name",_inputMuonName);
+        getOption("name of selected tight muons",_tightMuonName);
+        getOption("name of selected loose muons",_looseMuonName);
+        getOption("muon tight cuts",_muonTightCuts);
+        getOption("muon loose cuts",_muonLooseCuts);
+        getOption("tight muons",_numTightMuons);
+
+        getOption("input electron name",_inputElectronName);
+        getOption("name of selected tight electrons",_tightElectronName);
+        getOption("name of selected loose electrons",_looseElectronName);
+        getOption("electron tight cuts",_electronTightCuts);
+        getOption("electron loose cuts",_electronLooseCuts);
+        getOption("electron trigger preselection bins",_electronTriggerPreselectionBins);
+        getOption("tight electrons",_numTightElectrons);
+
+        getOption("input jet name",_inputJetName);
+        getOption("name of selected jets",_selectedJetName);
+        getOption("jet cuts",_jetCuts);
+
+        getOption("name of selected bjets",_selectedBJetName);
+        getOption("algorithm",_btaggerAlgorithmName);
+        getOption("btagger file",_btaggerFileName);
+
+        _cleaner.setMode(_cleanEvent ? CandidateCleaner::parseMode(_cleanMode) : CandidateCleaner::KEEP,_droppedName);
+
+        _electronTriggerPreselection.parseBins(_electronTriggerPreselectionBins);
+        _electronTriggerPreselection.reset();
+        _muonTightCutEngine.compile(_muonTightCuts);
+        _muonLooseCutEngine.compile(_muonLooseCuts);
+        _electronTightCutEngine.compile(_electronTightCuts);
+        _electronLooseCutEngine.compile(_electronLooseCuts);
+        _jetCutEngine.compile(_jetCuts);
+
+        _btaggerRegistry.reset();
+        if (_btaggerFileName.size()>0)
+        {
+            _btaggerRegistry.load(_btaggerFileName);
+        }
+        _btagEvaluator.setup(_btaggerRegistry,std::vector<std::string>(1,_btaggerAlgorithmName));
+    }
+
+    void endJob()
+    {
+    }
+
+    //returns the number of candidates which pass neither tight nor loose criteria
+    int selectLeptons(std::vector<pxl::Particle*>& candidates, CutEngine& tightCutEngine, CutEngine& looseCutEngine, const std::string& tightName, const std::string& looseName, int& numTight)
+    {
+        int numLoose=0;
+        for (unsigned icandidate=0; icandidate<candidates.size();++icandidate)
+        {
+            pxl::Particle* particle = candidates[icandidate];
+            if (tightCutEngine.pass(particle))
+            {
+                particle->setName(tightName);
+                ++numTight;
+            } else if (looseCutEngine.pass(particle)) {
+                particle->setName(looseName);
+                ++numLoose;
+            } else {
+                _cleaner.reject(particle);
+            }
+        }
+        return numLoose;
+    }
+
+    bool analyse(pxl::Sink *sink) throw (std::runtime_error)
+    {
+        try
+        {
+            pxl::Event *event  = dynamic_cast<pxl::Event *> (sink->get());
+            if (event)
+            {
+                int numTightMuons=0;
+                int numTightElectrons=0;
+                int numJets=0;
+                int numBJets=0;
+                _eventViewIndex.build(event);
+                const std::vector<pxl::EventView*>& eventViews = _eventViewIndex.get(_inputEventViewName);
+                _viewJets.resize(eventViews.size());
+                for (unsigned ieventView=0; ieventView<eventViews.size();++ieventView)
+                {
+                    pxl::EventView* eventView = eventViews[ieventView];
+                    std::vector<pxl::Particle*> particles;
+                    eventView->getObjectsOfType(particles);
+
+                    for (unsigned icategory=0; icategory<3; ++icategory)
+                    {
+                        _candidates[icategory].clear();
+                    }
+                    for (unsigned iparticle=0; iparticle<particles.size();++iparticle)
+                    {
+                        pxl::Particle* particle = particles[iparticle];
+                        if (particle->getName()==_inputMuonName)
+                        {
+                            _candidates[MUON].push_back(particle);
+                        } else if (particle->getName()==_inputElectronName) {
+                            _candidates[ELECTRON].push_back(particle);
+                        } else if (particle->getName()==_inputJetName) {
+                            _candidates[JET].push_back(particle);
+                        }
+                    }
+                    _viewJets[ieventView].swap(_candidates[JET]);
+
+                    //same early outs as the sequential chain
+                    if (selectLeptons(_candidates[MUON],_muonTightCutEngine,_muonLooseCutEngine,_tightMuonName,_looseMuonName,numTightMuons)>0)
+                    {
+                        _cleaner.clean(eventView);
+                        _sourceVeto->setTargets(event);
+                        return _sourceVeto->processTargets();
+                    }
+                    if (selectLeptons(_candidates[ELECTRON],_electronTightCutEngine,_electronLooseCutEngine,_tightElectronName,_looseElectronName,numTightElectrons)>0)
+                    {
+                        _cleaner.clean(eventView);
+                        _sourceVeto->setTargets(event);
+                        return _sourceVeto->processTargets();
+                    }
+                    _cleaner.clean(eventView);
+                }
+                //the lepton counts of all views decide like in the chain, the jets are then left untouched
+                if (numTightMuons!=_numTightMuons || numTightElectrons!=_numTightElectrons)
+                {
+                    _sourceFail->setTargets(event);
+                    return _sourceFail->processTargets();
+                }
+                for (unsigned ieventView=0; ieventView<eventViews.size();++ieventView)
+                {
+                    pxl::EventView* eventView = eventViews[ieventView];
+                    std::vector<pxl::Particle*>& jets = _viewJets[ieventView];
+                    for (unsigned ijet=0; ijet<jets.size();++ijet)
+                    {
+                        pxl::Particle* particle = jets[ijet];
+                        if (_jetCutEngine.pass(particle))
+                        {
+                            ++numJets;
+                            if (_btagEvaluator.evaluate(particle))
+                            {
+                                particle->setName(_selectedBJetName);
+                                ++numBJets;
+                            } else {
+                                particle->setName(_selectedJetName);
+                            }
+                        } else {
+                            _cleaner.reject(particle);
+                        }
+                    }
+                    _cleaner.clean(eventView);
+                    eventView->setUserRecord("numJets",numJets);
+                    eventView->setUserRecord("numBJets",numBJets);
+                }
+                if (_jetRouter.size()>0)
+                {
+                    return _router.process(numJets,numBJets,event);
+                }
+                return _router.process(numBJets,event);
+            }
+        }
+        catch(std::exception &e)
+        {
+            throw std::runtime_error(getName()+": "+e.what());
+        }
+        catch(...)
+        {
+            throw std::runtime_error(getName()+": unknown exception");
+        }
+
+        logger(pxl::LOG_LEVEL_ERROR , "Analysed event is not an pxl::Event !");
+        return false;
+    }
+
+    void shutdown() throw(std::runtime_error)
+    {
+    }
+
+    void destroy() throw (std::runtime_error)
+    {
+        delete this;
+    }
+};
+
+PXL_MODULE_INIT(DefaultObjectSelection)
+PXL_PLUGIN_INIT
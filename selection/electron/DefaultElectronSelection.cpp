@@ -5,45 +5,92 @@
 #include "pxl/modules/Module.hh"
 #include "pxl/modules/ModuleFactory.hh"
 
+#include "CutEngine.hpp"
+#include "MultiplicityRouter.hpp"
+#include "CandidateCleaner.hpp"
+#include "ElectronTriggerPreselection.hpp"
+#include "EventViewIndex.hpp"
+
 static pxl::Logger logger("DefaultElectronSelection");
 
 class DefaultElectronSelection : public pxl::Module
 {
     private:
-    pxl::Source* _sourceSelected_0electrons;
-    pxl::Source* _sourceSelected_1electrons;
-    pxl::Source* _sourceSelected_2electrons;
-    pxl::Source* _sourceSelected_otherelectrons;
-
     pxl::Source* _sourceVeto;
 
+    std::string _multiplicityBins;
+    MultiplicityRouter _router;
+
     std::string _inputElectronName;
     std::string _inputEventViewName;
+    EventViewIndex _eventViewIndex;
     std::string _tightElectronName;
     std::string _looseElectronName;
     bool _cleanEvent;
+    std::string _cleanMode;
+    std::string _droppedName;
+    CandidateCleaner _cleaner;
+
+    std::string _tightCuts;
+    std::string _looseCuts;
+    CutEngine _tightCutEngine;
+    CutEngine _looseCutEngine;
+    std::string _triggerPreselectionBins;
+    ElectronTriggerPreselection _triggerPreselection;
+
+    bool _cutFlow;
+    std::string _cutFlowFileName;
+    bool _adaptiveOrder;
+    int64_t _adaptiveWarmup;
+    bool _batchEvaluation;
+
+    std::vector<pxl::Particle*> _candidates;
+    std::vector<pxl::Particle*> _remaining;
+    std::vector<char> _passTight;
+    std::vector<char> _passLoose;
 
     public:
     DefaultElectronSelection() :
         Module(),
+        _multiplicityBins("0,1,2,>2"),
         _inputElectronName("Electron"),
         _inputEventViewName("Reconstructed"),
         _tightElectronName("TightElectron"),
         _looseElectronName("LooseElectron"),
-        _cleanEvent(true)
+        _cleanEvent(true),
+        _cleanMode("remove"),
+        _droppedName("Dropped"),
+        _tightCuts("pt > 30.0; abs(eta) > 2.5; isInEB-EE; passConversionVeto; mva > 0.5; triggerPreselection(); numberOfHits <= 0; relIso < 0.1"),
+        _looseCuts("pt > 10.0"),
+        _triggerPreselectionBins(ElectronTriggerPreselection::getDefaultBins()),
+        _cutFlow(false),
+        _cutFlowFileName(""),
+        _adaptiveOrder(false),
+        _adaptiveWarmup(1000),
+        _batchEvaluation(false)
     {
         addSink("input", "Input");
         _sourceVeto = addSource("veto", "veto");
-        _sourceSelected_otherelectrons = addSource(">2 ele", ">2 ele");
-        _sourceSelected_2electrons = addSource("2 ele", "2 ele");
-        _sourceSelected_1electrons = addSource("1 ele", "1 ele");
-        _sourceSelected_0electrons = addSource("0 ele", "0 ele");
 
         addOption("event view","name of the event view where electrons are selected",_inputEventViewName);
+        addOption("multiplicity bins","',' separated bins of the number of tight electrons routed to an own source, e.g. '0,1,2-3,>=4'; events outside the bins are dropped",_multiplicityBins);
         addOption("input electron name","name of particles to consider for selection",_inputElectronName);
         addOption("name of selected tight electrons","",_tightElectronName);
         addOption("name of selected loose electrons","",_looseElectronName);
         addOption("clean event","this option will clean the event of all electrons falling tight or loose criteria",_cleanEvent);
+        addOption("clean mode","'remove' deletes the rejected electrons from the view at a linear search per object, 'mark' renames them to the dropped name",_cleanMode);
+        addOption("dropped name","name given to rejected electrons in 'mark' mode",_droppedName);
+        addOption("tight cuts","';' separated list of cuts for tight electrons, triggerPreselection() applies the trigger emulation",_tightCuts);
+        addOption("loose cuts","';' separated list of cuts for loose electrons",_looseCuts);
+        addOption("trigger preselection bins","';' separated bins '<max |eta|> <sigmaIetaIeta> <hadronicOverEm> <track iso> <ecal iso> <hcal iso> <max lost hits>' of triggerPreselection() in |superClusterEta| with increasing edges, the last may be 'inf'; isolations relative to pt",_triggerPreselectionBins);
+        addOption("cut flow","count passed candidates and sample the cost per cut, printed at the end of the job",_cutFlow);
+        addOption("cut flow file","optional json output of the cut flow",_cutFlowFileName,pxl::OptionDescription::USAGE_FILE_SAVE);
+        addOption("adaptive cut order","reorder the cuts by measured rejection rate per cost after the warm-up, record cuts stay behind the cuts written before them",_adaptiveOrder);
+        addOption("adaptive warm-up","number of candidates used to measure the cuts before reordering",_adaptiveWarmup);
+        addOption("batch evaluation","evaluate each cut for all candidates of an event at once",_batchEvaluation);
+
+        _tightCutEngine.addPredicate("triggerPreselection",std::ref(_triggerPreselection));
+        _looseCutEngine.addPredicate("triggerPreselection",std::ref(_triggerPreselection));
 
     }
 
@@ -72,6 +119,9 @@ class DefaultElectronSelection : public pxl::Module
 
     void initialize() throw (std::runtime_error)
     {
+        getOption("multiplicity bins",_multiplicityBins);
+        _router.parse(_multiplicityBins,"ele");
+        _router.addSources(this);
     }
 
     void beginJob() throw (std::runtime_error)
@@ -81,121 +131,51 @@ class DefaultElectronSelection : public pxl::Module
         getOption("name of selected tight electrons",_tightElectronName);
         getOption("name of selected loose electrons",_looseElectronName);
         getOption("clean event",_cleanEvent);
-    }
+        getOption("clean mode",_cleanMode);
+        getOption("dropped name",_droppedName);
+        getOption("tight cuts",_tightCuts);
+        getOption("loose cuts",_looseCuts);
+        getOption("trigger preselection bins",_triggerPreselectionBins);
+        getOption("cut flow",_cutFlow);
+        getOption("cut flow file",_cutFlowFileName);
+        getOption("adaptive cut order",_adaptiveOrder);
+        getOption("adaptive warm-up",_adaptiveWarmup);
+        getOption("batch evaluation",_batchEvaluation);
 
-    bool passTriggerPreselection(pxl::Particle* particle)
-    {
-        if (fabs(particle->getUserRecord("superClusterEta").toFloat())<1.479)
+        _cleaner.setMode(_cleanEvent ? CandidateCleaner::parseMode(_cleanMode) : CandidateCleaner::KEEP,_droppedName);
+
+        _triggerPreselection.parseBins(_triggerPreselectionBins);
+        _triggerPreselection.reset();
+        _tightCutEngine.compile(_tightCuts);
+        _looseCutEngine.compile(_looseCuts);
+        _tightCutEngine.setBatchEvaluation(_batchEvaluation);
+        _looseCutEngine.setBatchEvaluation(_batchEvaluation);
+
+        if (_cutFlow)
         {
-            if (not (particle->getUserRecord("sigmaIetaIeta").toFloat()<0.014))
-            {
-                return false;
-            }
-            if (not (particle->getUserRecord("hadronicOverEm").toFloat()<0.15))
-            {
-                return false;
-            }
-//---------------------------------------------------------------------------------------------------------------------------
-//remove if else branch when dr03TkSumP changed to dr03TkSumPt with next reprocessing
-            if (particle->hasUserRecord("dr03TkSumP")) {
-                if (not (particle->getUserRecord("dr03TkSumP").toFloat()/particle->getPt()<0.2))
-                {
-                    return false;
-                }
-            } else {
-                if (not (particle->getUserRecord("dr03TkSumPt").toFloat()/particle->getPt()<0.2))
-                {
-                    return false;
-                }
-            }
-//---------------------------------------------------------------------------------------------------------------------------
-            if (not (particle->getUserRecord("dr03EcalRecHitSumEt").toFloat()/particle->getPt()<0.2))
-            {
-                return false;
-            }
-            if (not (particle->getUserRecord("dr03HcalTowerSumEt").toFloat()/particle->getPt()<0.2))
-            {
-                return false;
-            }
-            if (not (particle->getUserRecord("numberOfLostHits").toInt32()==0))
-            {
-                return false;
-            }
-            return true;
-        } else {
-            if (not (particle->getUserRecord("sigmaIetaIeta").toFloat()<0.035))
-            {
-                return false;
-            }
-            if (not (particle->getUserRecord("hadronicOverEm").toFloat()<0.10))
-            {
-                return false;
-            }
-//---------------------------------------------------------------------------------------------------------------------------
-//remove if else branch when dr03TkSumP changed to dr03TkSumPt with next reprocessing
-            if (particle->hasUserRecord("dr03TkSumP")) {
-                if (not (particle->getUserRecord("dr03TkSumP").toFloat()/particle->getPt()<0.2))
-                {
-                    return false;
-                }
-            } else {
-                if (not (particle->getUserRecord("dr03TkSumPt").toFloat()/particle->getPt()<0.2))
-                {
-                    return false;
-                }
-            }
-//---------------------------------------------------------------------------------------------------------------------------
-            if (not (particle->getUserRecord("dr03EcalRecHitSumEt").toFloat()/particle->getPt()<0.2))
-            {
-                return false;
-            }
-            if (not (particle->getUserRecord("dr03HcalTowerSumEt").toFloat()/particle->getPt()<0.2))
-            {
-                return false;
-            }
-            if (not (particle->getUserRecord("numberOfLostHits").toInt32()==0))
+            _tightCutEngine.enableCutFlow("tight");
+            _looseCutEngine.enableCutFlow("loose");
+        }
+        if (_adaptiveOrder)
+        {
+            if (_adaptiveWarmup<1)
             {
-                return false;
+                throw std::runtime_error("adaptive warm-up needs to be at least 1");
             }
-            return true;
+            _tightCutEngine.enableAdaptiveOrder(_adaptiveWarmup);
+            _looseCutEngine.enableAdaptiveOrder(_adaptiveWarmup);
         }
     }
 
-    bool passTightCriteria(pxl::Particle* particle)
+    void endJob()
     {
-        if (not (particle->getPt()>30.0)) {
-            return false;
-        }
-        if (not (fabs(particle->getEta())>2.5)) {
-            return false;
-        }
-        if (not (particle->getUserRecord("isInEB-EE").toBool())) {
-            return false;
-        }
-        if (not (particle->getUserRecord("passConversionVeto").toBool())) {
-            return false;
-        }
-        if (not (particle->getUserRecord("mva").toFloat()>0.5)) {
-            return false;
-        }
-        if (not passTriggerPreselection(particle)) {
-            return false;
-        }
-        if (not (particle->getUserRecord("numberOfHits").toInt32()<=0)) {
-            return false;
-        }
-        if (not (particle->getUserRecord("relIso").toFloat()<0.1)) {
-            return false;
-        }
-        return true;
-    }
-
-    bool passLooseCriteria(pxl::Particle* particle)
-    {
-        if (not (particle->getPt()>10.0)) {
-            return false;
+        if (_cutFlow)
+        {
+            std::vector<const CutFlow*> cutFlows;
+            cutFlows.push_back(&_tightCutEngine.getCutFlow());
+            cutFlows.push_back(&_looseCutEngine.getCutFlow());
+            CutFlow::report(getName(),_cutFlowFileName,cutFlows);
         }
-        return true;
     }
 
     bool analyse(pxl::Sink *sink) throw (std::runtime_error)
@@ -207,60 +187,58 @@ class DefaultElectronSelection : public pxl::Module
             {
                 int numTightElectrons=0;
                 int numLooseElectrons=0;
-                std::vector<pxl::EventView*> eventViews;
-                event->getObjectsOfType(eventViews);
+                _eventViewIndex.build(event);
+                const std::vector<pxl::EventView*>& eventViews = _eventViewIndex.get(_inputEventViewName);
                 for (unsigned ieventView=0; ieventView<eventViews.size();++ieventView)
                 {
                     pxl::EventView* eventView = eventViews[ieventView];
-                    if (eventView->getName()==_inputEventViewName)
+                    std::vector<pxl::Particle*> particles;
+                    eventView->getObjectsOfType(particles);
+
+                    _candidates.clear();
+                    for (unsigned iparticle=0; iparticle<particles.size();++iparticle)
                     {
-                        std::vector<pxl::Particle*> particles;
-                        eventView->getObjectsOfType(particles);
+                        pxl::Particle* particle = particles[iparticle];
+
+                        if (particle->getName()==_inputElectronName)
+                        {
+                            _candidates.push_back(particle);
+                        }
+                    }
 
-                        for (unsigned iparticle=0; iparticle<particles.size();++iparticle)
+                    _tightCutEngine.pass(_candidates,_passTight);
+                    _remaining.clear();
+                    for (unsigned icandidate=0; icandidate<_candidates.size();++icandidate)
+                    {
+                        if (_passTight[icandidate])
                         {
-                            pxl::Particle* particle = particles[iparticle];
-
-                            if (particle->getName()==_inputElectronName)
-                            {
-                                if (passTightCriteria(particle))
-                                {
-                                    particle->setName(_tightElectronName);
-                                    ++numTightElectrons;
-                                } else if (passLooseCriteria(particle)) {
-                                    particle->setName(_looseElectronName);
-                                    ++numLooseElectrons;
-                                } else if (_cleanEvent) {
-                                    eventView->removeObject(particle);
-                                }
-
-                            }
+                            _candidates[icandidate]->setName(_tightElectronName);
+                            ++numTightElectrons;
+                        } else {
+                            _remaining.push_back(_candidates[icandidate]);
                         }
+                    }
 
+                    _looseCutEngine.pass(_remaining,_passLoose);
+                    for (unsigned icandidate=0; icandidate<_remaining.size();++icandidate)
+                    {
+                        if (_passLoose[icandidate])
+                        {
+                            _remaining[icandidate]->setName(_looseElectronName);
+                            ++numLooseElectrons;
+                        } else {
+                            _cleaner.reject(_remaining[icandidate]);
+                        }
                     }
+                    _cleaner.clean(eventView);
+
                 }
                 if (numLooseElectrons>0)
                 {
                     _sourceVeto->setTargets(event);
                     return _sourceVeto->processTargets();
                 }
-                pxl::Source* sourceSelected=0;
-                switch (numTightElectrons)
-                {
-                    case 0:
-                        sourceSelected = _sourceSelected_0electrons;
-                        break;
-                    case 1:
-                        sourceSelected = _sourceSelected_1electrons;
-                        break;
-                    case 2:
-                        sourceSelected = _sourceSelected_2electrons;
-                        break;
-                    default:
-                        sourceSelected = _sourceSelected_otherelectrons;
-                }
-                sourceSelected->setTargets(event);
-                return sourceSelected->processTargets();
+                return _router.process(numTightElectrons,event);
 
             }
         }
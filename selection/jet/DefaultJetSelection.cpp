@@ -5,48 +5,121 @@
 #include "pxl/modules/Module.hh"
 #include "pxl/modules/ModuleFactory.hh"
 
+#include "CutEngine.hpp"
+#include "MultiplicityRouter.hpp"
+#include "CandidateCleaner.hpp"
+#include "EtaPhiGrid.hpp"
+#include "EventViewIndex.hpp"
+
+#include <cstdlib>
+#include <sstream>
+#include <unordered_map>
+#include <cstdint>
+
 static pxl::Logger logger("DefaultJetSelection");
 
 class DefaultJetSelection : public pxl::Module
 {
     private:
-    pxl::Source* _sourceSelected_0jets;
-    pxl::Source* _sourceSelected_1jets;
-    pxl::Source* _sourceSelected_2jets;
-    pxl::Source* _sourceSelected_3jets;
-    pxl::Source* _sourceSelected_4jets;
-    pxl::Source* _sourceSelected_5jets;
-    pxl::Source* _sourceSelected_6jets;
-    pxl::Source* _sourceSelected_otherjets;
     pxl::Source* _sourceVeto;
 
+    std::string _multiplicityBins;
+    MultiplicityRouter _router;
+
     std::string _inputJetName;
     std::string _inputEventViewName;
+    EventViewIndex _eventViewIndex;
     std::string _selectedJetName;
     bool _cleanEvent;
+    std::string _cleanMode;
+    std::string _droppedName;
+    CandidateCleaner _cleaner;
+
+    std::string _cuts;
+    CutEngine _cutEngine;
+
+    bool _cutFlow;
+    std::string _cutFlowFileName;
+    bool _adaptiveOrder;
+    int64_t _adaptiveWarmup;
+    bool _batchEvaluation;
+
+    std::vector<pxl::Particle*> _candidates;
+    std::vector<char> _passSelection;
+
+    bool _overlapRemoval;
+    std::string _overlapCones;
+    std::string _overlapPrecedence;
+    bool _overlapJetsWin;
+    double _maxOverlapCone;
+    std::unordered_map<std::string,double> _overlapConeMap;
+    EtaPhiGrid<unsigned> _overlapGrid;
+    std::vector<pxl::Particle*> _overlapLeptons;
+    std::vector<double> _overlapLeptonCones;
+    std::vector<char> _overlapLeptonRejected;
+    //leptons losing against a jet, cleaned like the jets
+    CandidateCleaner _leptonCleaner;
+
+    //scale variations of the jet four-vectors evaluated in the same pass
+    struct ScaleVariation
+    {
+        std::string name;
+        std::string record;
+        double factor;
+    };
+
+    std::string _scaleVariationNames;
+    std::string _variationMaskName;
+    std::vector<ScaleVariation> _scaleVariations;
+    std::vector<std::string> _variationCountNames;
+    std::vector<int> _variationCounts;
+    std::vector<double> _variationScales;
+    std::vector<char> _passVariations;
 
     public:
     DefaultJetSelection() :
         Module(),
+        _multiplicityBins("0,1,2,3,4,5,6,>6"),
         _inputJetName("Jet"),
         _inputEventViewName("Reconstructed"),
         _selectedJetName("SelectedJet"),
-        _cleanEvent(true)
+        _cleanEvent(true),
+        _cleanMode("remove"),
+        _droppedName("Dropped"),
+        _cuts("pt > 30.0; numberOfDaughters > 1; neutralEmEnergyFraction < 0.99; abs(eta) < 2.4 -> chargedEmEnergyFraction < 0.99; abs(eta) < 2.4 -> chargedHadronEnergyFraction > 0.0; abs(eta) < 2.4 -> chargedMultiplicity > 0"),
+        _cutFlow(false),
+        _cutFlowFileName(""),
+        _adaptiveOrder(false),
+        _adaptiveWarmup(1000),
+        _batchEvaluation(false),
+        _overlapRemoval(false),
+        _overlapCones("TightMuon:0.4; TightElectron:0.4"),
+        _overlapPrecedence("leptons"),
+        _overlapJetsWin(false),
+        _maxOverlapCone(0.4),
+        _scaleVariationNames(""),
+        _variationMaskName("scaleVariations")
     {
         addSink("input", "Input");
-        _sourceSelected_otherjets = addSource(">6 jets", ">6 jets");
-        _sourceSelected_6jets = addSource("6 jets", "6 jets");
-        _sourceSelected_5jets = addSource("5 jets", "5 jets");
-        _sourceSelected_4jets = addSource("4 jets", "4 jets");
-        _sourceSelected_3jets = addSource("3 jets", "3 jets");
-        _sourceSelected_2jets = addSource("2 jets", "2 jets");
-        _sourceSelected_1jets = addSource("1 jets", "1 jets");
-        _sourceSelected_0jets = addSource("0 jets", "0 jets");
 
         addOption("event view","name of the event view where jets are selected",_inputEventViewName);
+        addOption("multiplicity bins","',' separated bins of the number of selected jets routed to an own source, e.g. '0,1,2-3,>=4'; events outside the bins are dropped",_multiplicityBins);
         addOption("input jet name","name of particles to consider for selection",_inputJetName);
         addOption("name of selected jets","",_selectedJetName);
         addOption("clean event","this option will clean the event of all jets falling selection",_cleanEvent);
+        addOption("clean mode","'remove' deletes the rejected jets from the view at a linear search per object, 'mark' renames them to the dropped name",_cleanMode);
+        addOption("dropped name","name given to rejected jets in 'mark' mode",_droppedName);
+        addOption("cuts","';' separated list of jet cuts",_cuts);
+        addOption("cut flow","count passed candidates and sample the cost per cut, printed at the end of the job",_cutFlow);
+        addOption("cut flow file","optional json output of the cut flow",_cutFlowFileName,pxl::OptionDescription::USAGE_FILE_SAVE);
+        addOption("adaptive cut order","reorder the cuts by measured rejection rate per cost after the warm-up, record cuts stay behind the cuts written before them",_adaptiveOrder);
+        addOption("adaptive warm-up","number of candidates used to measure the cuts before reordering",_adaptiveWarmup);
+        addOption("batch evaluation","evaluate each cut for all candidates of an event at once",_batchEvaluation);
+        addOption("overlap removal","remove overlaps between selected jets and the leptons listed in the overlap cones",_overlapRemoval);
+        addOption("overlap cones","';' separated list of 'name:deltaR' of particles to cross-clean against the jets",_overlapCones);
+        addOption("overlap precedence","'leptons' drops jets overlapping a lepton, 'jets' flags leptons overlapping a selected jet with the record 'overlapsJet' and cleans them like the jets; the lepton multiplicity routing upstream is not revised",_overlapPrecedence);
+        addOption("scale variations","';' separated list of 'name:factor' or 'name:record' scaling pt, energy and mass of the jets; the number of jets per variation is stored as numJets_<name>",_scaleVariationNames);
+        addOption("variation mask record","per jet bitmask of the passed scale variations, jets passing only a variation are kept under their input name",_variationMaskName);
     }
 
     ~DefaultJetSelection()
@@ -74,6 +147,9 @@ class DefaultJetSelection : public pxl::Module
 
     void initialize() throw (std::runtime_error)
     {
+        getOption("multiplicity bins",_multiplicityBins);
+        _router.parse(_multiplicityBins,"jets");
+        _router.addSources(this);
     }
 
     void beginJob() throw (std::runtime_error)
@@ -82,38 +158,176 @@ class DefaultJetSelection : public pxl::Module
         getOption("input jet name",_inputJetName);
         getOption("name of selected jets",_selectedJetName);
         getOption("clean event",_cleanEvent);
+        getOption("clean mode",_cleanMode);
+        getOption("dropped name",_droppedName);
+        getOption("cuts",_cuts);
+        getOption("cut flow",_cutFlow);
+        getOption("cut flow file",_cutFlowFileName);
+        getOption("adaptive cut order",_adaptiveOrder);
+        getOption("adaptive warm-up",_adaptiveWarmup);
+        getOption("batch evaluation",_batchEvaluation);
+
+        _cleaner.setMode(_cleanEvent ? CandidateCleaner::parseMode(_cleanMode) : CandidateCleaner::KEEP,_droppedName);
+
+        getOption("overlap removal",_overlapRemoval);
+        getOption("overlap cones",_overlapCones);
+        getOption("overlap precedence",_overlapPrecedence);
+        getOption("scale variations",_scaleVariationNames);
+        getOption("variation mask record",_variationMaskName);
+
+        parseScaleVariations();
+
+        if (_overlapRemoval)
+        {
+            parseOverlapCones();
+            if (_overlapPrecedence=="leptons")
+            {
+                _overlapJetsWin=false;
+            } else if (_overlapPrecedence=="jets") {
+                _overlapJetsWin=true;
+            } else {
+                throw std::runtime_error("unknown overlap precedence '"+_overlapPrecedence+"', use 'leptons' or 'jets'");
+            }
+            _overlapGrid.configure(_maxOverlapCone,5.0);
+            _leptonCleaner.setMode(_cleanEvent ? CandidateCleaner::parseMode(_cleanMode) : CandidateCleaner::KEEP,_droppedName);
+        }
+
+        _cutEngine.compile(_cuts);
+        _cutEngine.setBatchEvaluation(_batchEvaluation);
+
+        if (_cutFlow)
+        {
+            _cutEngine.enableCutFlow("selection");
+        }
+        if (_adaptiveOrder)
+        {
+            if (_adaptiveWarmup<1)
+            {
+                throw std::runtime_error("adaptive warm-up needs to be at least 1");
+            }
+            _cutEngine.enableAdaptiveOrder(_adaptiveWarmup);
+        }
     }
 
-    bool passSelection(pxl::Particle* particle)
+    void endJob()
     {
-        if (not (particle->getPt()>30.0)) {
-            return false;
+        if (_cutFlow)
+        {
+            std::vector<const CutFlow*> cutFlows;
+            cutFlows.push_back(&_cutEngine.getCutFlow());
+            CutFlow::report(getName(),_cutFlowFileName,cutFlows);
         }
-        if (not (particle->getUserRecord("numberOfDaughters").toInt32()>1)) {
-            return false;
+    }
+
+    void parseOverlapCones() throw (std::runtime_error)
+    {
+        _overlapConeMap.clear();
+        _maxOverlapCone=0.0;
+        std::istringstream cones(_overlapCones);
+        std::string cone;
+        while (std::getline(cones,cone,';'))
+        {
+            size_t begin = cone.find_first_not_of(" \t");
+            if (begin==std::string::npos)
+            {
+                continue;
+            }
+            size_t end = cone.find_last_not_of(" \t");
+            cone = cone.substr(begin,end-begin+1);
+            size_t separator = cone.rfind(':');
+            char* parsed = 0;
+            double deltaR = separator==std::string::npos ? 0.0 : strtod(cone.c_str()+separator+1,&parsed);
+            if (separator==std::string::npos || separator==0 || parsed==cone.c_str()+separator+1 || deltaR<=0.0)
+            {
+                throw std::runtime_error("cannot parse overlap cone '"+cone+"', expected 'name:deltaR'");
+            }
+            _overlapConeMap[cone.substr(0,cone.find_last_not_of(" \t",separator-1)+1)]=deltaR;
+            _maxOverlapCone=std::max(_maxOverlapCone,deltaR);
         }
-        //-----------------------------------------------------------------------
-        //double nhf = 0;
-        //-----------------------------------------------------------------------
-        //NEF
-        if (not (particle->getUserRecord("neutralEmEnergyFraction").toFloat()<0.99)) {
-            return false;
+        if (_overlapConeMap.empty())
+        {
+            throw std::runtime_error("overlap removal requires at least one overlap cone");
         }
-        if (fabs(particle->getEta())<2.4) {
-            //CEF
-            if (not (particle->getUserRecord("chargedEmEnergyFraction").toFloat()<0.99)) {
-                return false;
+    }
+
+    void parseScaleVariations() throw (std::runtime_error)
+    {
+        _scaleVariations.clear();
+        _variationCountNames.clear();
+        std::istringstream variations(_scaleVariationNames);
+        std::string variation;
+        while (std::getline(variations,variation,';'))
+        {
+            size_t begin = variation.find_first_not_of(" \t");
+            if (begin==std::string::npos)
+            {
+                continue;
             }
-            //CHF
-            if (not (particle->getUserRecord("chargedHadronEnergyFraction").toFloat()>0.0)) {
-                return false;
+            size_t end = variation.find_last_not_of(" \t");
+            variation = variation.substr(begin,end-begin+1);
+            size_t separator = variation.find(':');
+            if (separator==std::string::npos || separator==0 || separator+1==variation.size())
+            {
+                throw std::runtime_error("cannot parse scale variation '"+variation+"', expected 'name:factor' or 'name:record'");
             }
-            //NCH
-            if (not (particle->getUserRecord("chargedMultiplicity").toInt32()>0)) {
-                return false;
+            ScaleVariation scaleVariation;
+            scaleVariation.name = variation.substr(0,variation.find_last_not_of(" \t",separator-1)+1);
+            std::string value = variation.substr(variation.find_first_not_of(" \t",separator+1));
+            char* parsed = 0;
+            scaleVariation.factor = strtod(value.c_str(),&parsed);
+            if (*parsed!='\0')
+            {
+                //not a number: the factor is read per jet from this user record
+                scaleVariation.record = value;
+                scaleVariation.factor = 1.0;
             }
+            _scaleVariations.push_back(scaleVariation);
+            _variationCountNames.push_back("numJets_"+scaleVariation.name);
+        }
+        if (_scaleVariations.size()>32)
+        {
+            throw std::runtime_error("at most 32 scale variations can be evaluated at once");
+        }
+        _variationCounts.assign(_scaleVariations.size(),0);
+        _variationScales.resize(_scaleVariations.size());
+    }
+
+    //the cuts not depending on the scale are skipped for jets passing the nominal selection
+    uint32_t evaluateScaleVariations(pxl::Particle* jet, bool selected)
+    {
+        for (unsigned ivariation=0; ivariation<_scaleVariations.size(); ++ivariation)
+        {
+            const ScaleVariation& scaleVariation = _scaleVariations[ivariation];
+            _variationScales[ivariation] = scaleVariation.record.size()>0 ? jet->getUserRecord(scaleVariation.record).toDouble() : scaleVariation.factor;
+        }
+        _cutEngine.passScaled(jet,_variationScales,_passVariations,selected);
+        uint32_t mask = 0;
+        for (unsigned ivariation=0; ivariation<_passVariations.size(); ++ivariation)
+        {
+            mask |= uint32_t(_passVariations[ivariation]!=0)<<ivariation;
         }
-        return true;
+        return mask;
+    }
+
+    //returns true if the jet lies inside the cone of any lepton; with jet
+    //precedence the overlapping leptons are flagged for rejection instead
+    bool overlapsLepton(pxl::Particle* jet, bool flagLeptons)
+    {
+        bool overlaps = false;
+        _overlapGrid.visitNeighbours(jet->getEta(),jet->getPhi(),_maxOverlapCone,
+            [&](const EtaPhiGrid<unsigned>::Entry& entry, double deltaR)
+            {
+                if (deltaR<_overlapLeptonCones[entry.value])
+                {
+                    overlaps = true;
+                    if (_overlapJetsWin && flagLeptons)
+                    {
+                        _overlapLeptonRejected[entry.value]=1;
+                    }
+                }
+            }
+        );
+        return overlaps && !_overlapJetsWin;
     }
 
     bool analyse(pxl::Sink *sink) throw (std::runtime_error)
@@ -124,62 +338,88 @@ class DefaultJetSelection : public pxl::Module
             if (event)
             {
                 int numJets=0;
-                std::vector<pxl::EventView*> eventViews;
-                event->getObjectsOfType(eventViews);
+                _eventViewIndex.build(event);
+                const std::vector<pxl::EventView*>& eventViews = _eventViewIndex.get(_inputEventViewName);
                 for (unsigned ieventView=0; ieventView<eventViews.size();++ieventView)
                 {
                     pxl::EventView* eventView = eventViews[ieventView];
-                    if (eventView->getName()==_inputEventViewName)
+                    std::vector<pxl::Particle*> particles;
+                    eventView->getObjectsOfType(particles);
+                    _candidates.clear();
+                    if (_overlapRemoval)
                     {
-                        std::vector<pxl::Particle*> particles;
-                        eventView->getObjectsOfType(particles);
-                        for (unsigned iparticle=0; iparticle<particles.size();++iparticle)
+                        _overlapGrid.clear();
+                        _overlapLeptons.clear();
+                        _overlapLeptonCones.clear();
+                    }
+                    for (unsigned iparticle=0; iparticle<particles.size();++iparticle)
+                    {
+                        pxl::Particle* particle = particles[iparticle];
+                        if (particle->getName()==_inputJetName)
                         {
-                            pxl::Particle* particle = particles[iparticle];
-                            if (particle->getName()==_inputJetName)
+                            _candidates.push_back(particle);
+                        } else if (_overlapRemoval) {
+                            std::unordered_map<std::string,double>::const_iterator cone = _overlapConeMap.find(particle->getName());
+                            if (cone!=_overlapConeMap.end())
                             {
-                                if (passSelection(particle))
-                                {
-                                    particle->setName(_selectedJetName);
-                                    ++numJets;
-                                } else if  (_cleanEvent) {
-                                    eventView->removeObject(particle);
-                                }
+                                _overlapGrid.insert(particle->getEta(),particle->getPhi(),_overlapLeptons.size());
+                                _overlapLeptons.push_back(particle);
+                                _overlapLeptonCones.push_back(cone->second);
                             }
+                        }
 
+                    }
+                    _overlapLeptonRejected.assign(_overlapLeptons.size(),0);
+
+                    _cutEngine.pass(_candidates,_passSelection);
+                    _variationCounts.assign(_variationCounts.size(),0);
+                    for (unsigned icandidate=0; icandidate<_candidates.size();++icandidate)
+                    {
+                        pxl::Particle* jet = _candidates[icandidate];
+                        bool selected = _passSelection[icandidate];
+                        uint32_t variations = _scaleVariations.size()>0 ? evaluateScaleVariations(jet,selected) : 0;
+                        //the overlap does not depend on the jet energy scale
+                        if ((selected || variations) && _overlapLeptons.size()>0 && overlapsLepton(jet,selected))
+                        {
+                            selected = false;
+                            variations = 0;
+                        }
+                        if (_scaleVariations.size()>0)
+                        {
+                            jet->setUserRecord(_variationMaskName,variations);
+                            for (unsigned ivariation=0; ivariation<_variationCounts.size(); ++ivariation)
+                            {
+                                _variationCounts[ivariation]+=(variations>>ivariation)&1;
+                            }
+                        }
+                        if (selected)
+                        {
+                            jet->setName(_selectedJetName);
+                            ++numJets;
+                        } else if (!variations) {
+                            _cleaner.reject(jet);
                         }
-                        eventView->setUserRecord("numJets",numJets);
+                    }
+                    //the events were already routed on the tight lepton counts by the
+                    //lepton selections, dropping a lepton here does not change that;
+                    //without cleaning the record is the only trace of the overlap
+                    for (unsigned ilepton=0; ilepton<_overlapLeptonRejected.size();++ilepton)
+                    {
+                        if (_overlapLeptonRejected[ilepton])
+                        {
+                            _overlapLeptons[ilepton]->setUserRecord("overlapsJet",true);
+                            _leptonCleaner.reject(_overlapLeptons[ilepton]);
+                        }
+                    }
+                    _cleaner.clean(eventView);
+                    _leptonCleaner.clean(eventView);
+                    eventView->setUserRecord("numJets",numJets);
+                    for (unsigned ivariation=0; ivariation<_variationCounts.size(); ++ivariation)
+                    {
+                        eventView->setUserRecord(_variationCountNames[ivariation],_variationCounts[ivariation]);
                     }
                 }
-                pxl::Source* sourceSelected=0;
-                switch (numJets)
-                {
-                    case 0:
-                        sourceSelected = _sourceSelected_0jets;
-                        break;
-                    case 1:
-                        sourceSelected = _sourceSelected_1jets;
-                        break;
-                    case 2:
-                        sourceSelected = _sourceSelected_2jets;
-                        break;
-                    case 3:
-                        sourceSelected = _sourceSelected_3jets;
-                        break;
-                    case 4:
-                        sourceSelected = _sourceSelected_4jets;
-                        break;
-                    case 5:
-                        sourceSelected = _sourceSelected_5jets;
-                        break;
-                    case 6:
-                        sourceSelected = _sourceSelected_6jets;
-                        break;
-                    default:
-                        sourceSelected = _sourceSelected_otherjets;
-                }
-                sourceSelected->setTargets(event);
-                return sourceSelected->processTargets();
+                return _router.process(numJets,event);
             }
         }
         catch(std::exception &e)
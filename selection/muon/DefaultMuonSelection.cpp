@@ -5,46 +5,85 @@
 #include "pxl/modules/Module.hh"
 #include "pxl/modules/ModuleFactory.hh"
 
+#include "CutEngine.hpp"
+#include "MultiplicityRouter.hpp"
+#include "CandidateCleaner.hpp"
+#include "EventViewIndex.hpp"
+
 static pxl::Logger logger("DefaultMuonSelection");
 
 class DefaultMuonSelection : public pxl::Module
 {
     private:
-    pxl::Source* _sourceSelected_0muons;
-    pxl::Source* _sourceSelected_1muons;
-    pxl::Source* _sourceSelected_2muons;
-    pxl::Source* _sourceSelected_othermuons;
-
     pxl::Source* _sourceVeto;
 
+    std::string _multiplicityBins;
+    MultiplicityRouter _router;
+
     std::string _inputMuonName;
     std::string _inputEventViewName;
+    EventViewIndex _eventViewIndex;
     std::string _tightMuonName;
     std::string _looseMuonName;
     bool _cleanEvent;
+    std::string _cleanMode;
+    std::string _droppedName;
+    CandidateCleaner _cleaner;
+
+    std::string _tightCuts;
+    std::string _looseCuts;
+    CutEngine _tightCutEngine;
+    CutEngine _looseCutEngine;
+
+    bool _cutFlow;
+    std::string _cutFlowFileName;
+    bool _adaptiveOrder;
+    int64_t _adaptiveWarmup;
+    bool _batchEvaluation;
+
+    std::vector<pxl::Particle*> _candidates;
+    std::vector<pxl::Particle*> _remaining;
+    std::vector<char> _passTight;
+    std::vector<char> _passLoose;
 
     public:
     DefaultMuonSelection() :
         Module(),
+        _multiplicityBins("0,1,2,>2"),
         _inputMuonName("Muon"),
         _inputEventViewName("Reconstructed"),
         _tightMuonName("TightMuon"),
         _looseMuonName("LooseMuon"),
-        _cleanEvent(true)
+        _cleanEvent(true),
+        _cleanMode("remove"),
+        _droppedName("Dropped"),
+        _tightCuts("pt > 26.0; abs(eta) < 2.1; isPFMuon; isGlobalMuon; chi2 < 10.0; numberOfValidMuonHits > 0; numberOfMatchedStations > 1; abs(dxy) < 0.2; abs(dz) < 0.5; numberOfValidPixelHits > 0; trackerLayersWithMeasurement > 5; relIso < 0.12"),
+        _looseCuts("pt > 10.0; abs(eta) < 2.5; relIso < 0.2; abs(dxy) < 0.2; abs(dz) < 0.5"),
+        _cutFlow(false),
+        _cutFlowFileName(""),
+        _adaptiveOrder(false),
+        _adaptiveWarmup(1000),
+        _batchEvaluation(false)
     {
         addSink("input", "Input");
         _sourceVeto = addSource("veto", "veto");
-        _sourceSelected_othermuons = addSource(">2 muons", ">2 muons");
-        _sourceSelected_2muons = addSource("2 muons", "2 muons");
-        _sourceSelected_1muons = addSource("1 muons", "1 muons");
-        _sourceSelected_0muons = addSource("0 muons", "0 muons");
 
 
         addOption("event view","name of the event view where muons are selected",_inputEventViewName);
+        addOption("multiplicity bins","',' separated bins of the number of tight muons routed to an own source, e.g. '0,1,2-3,>=4'; events outside the bins are dropped",_multiplicityBins);
         addOption("input muon name","name of particles to consider for selection",_inputMuonName);
         addOption("name of selected tight muons","",_tightMuonName);
         addOption("name of selected loose muons","",_looseMuonName);
         addOption("clean event","this option will clean the event of all muons falling tight or loose criteria",_cleanEvent);
+        addOption("clean mode","'remove' deletes the rejected muons from the view at a linear search per object, 'mark' renames them to the dropped name",_cleanMode);
+        addOption("dropped name","name given to rejected muons in 'mark' mode",_droppedName);
+        addOption("tight cuts","';' separated list of cuts for tight muons",_tightCuts);
+        addOption("loose cuts","';' separated list of cuts for loose muons",_looseCuts);
+        addOption("cut flow","count passed candidates and sample the cost per cut, printed at the end of the job",_cutFlow);
+        addOption("cut flow file","optional json output of the cut flow",_cutFlowFileName,pxl::OptionDescription::USAGE_FILE_SAVE);
+        addOption("adaptive cut order","reorder the cuts by measured rejection rate per cost after the warm-up, record cuts stay behind the cuts written before them",_adaptiveOrder);
+        addOption("adaptive warm-up","number of candidates used to measure the cuts before reordering",_adaptiveWarmup);
+        addOption("batch evaluation","evaluate each cut for all candidates of an event at once",_batchEvaluation);
     }
 
     ~DefaultMuonSelection()
@@ -72,6 +111,9 @@ class DefaultMuonSelection : public pxl::Module
 
     void initialize() throw (std::runtime_error)
     {
+        getOption("multiplicity bins",_multiplicityBins);
+        _router.parse(_multiplicityBins,"muons");
+        _router.addSources(this);
     }
 
     void beginJob() throw (std::runtime_error)
@@ -81,70 +123,48 @@ class DefaultMuonSelection : public pxl::Module
         getOption("name of selected tight muons",_tightMuonName);
         getOption("name of selected loose muons",_looseMuonName);
         getOption("clean event",_cleanEvent);
-    }
+        getOption("clean mode",_cleanMode);
+        getOption("dropped name",_droppedName);
+        getOption("tight cuts",_tightCuts);
+        getOption("loose cuts",_looseCuts);
+        getOption("cut flow",_cutFlow);
+        getOption("cut flow file",_cutFlowFileName);
+        getOption("adaptive cut order",_adaptiveOrder);
+        getOption("adaptive warm-up",_adaptiveWarmup);
+        getOption("batch evaluation",_batchEvaluation);
 
-    bool passTightCriteria(pxl::Particle* particle)
-    {
-        if (not (particle->getPt()>26.0)) {
-            return false;
-        }
-        if (not (fabs(particle->getEta())<2.1)) {
-            return false;
-        }
-        if (not particle->getUserRecord("isPFMuon").toBool()) {
-            return false;
-        }
-        if (not particle->getUserRecord("isGlobalMuon").toBool()) {
-            return false;
-        }
-        if (not (particle->getUserRecord("chi2").toFloat()<10.0)) {
-            return false;
-        }
-        if (not (particle->getUserRecord("numberOfValidMuonHits").toInt32()>0)) {
-            return false;
-        }
-        if (not (particle->getUserRecord("numberOfMatchedStations").toInt32()>1)) {
-            return false;
-        }
-        if (not (fabs(particle->getUserRecord("dxy").toFloat())<0.2)) {
-            return false;
-        }
-        if (not (fabs(particle->getUserRecord("dz").toFloat())<0.5)) {
-            return false;
-        }
-        if (not (particle->getUserRecord("numberOfValidPixelHits").toInt32()>0)) {
-            return false;
-        }
-        if (not (particle->getUserRecord("trackerLayersWithMeasurement").toInt32()>5)) {
-            return false;
+        _cleaner.setMode(_cleanEvent ? CandidateCleaner::parseMode(_cleanMode) : CandidateCleaner::KEEP,_droppedName);
+
+        _tightCutEngine.compile(_tightCuts);
+        _looseCutEngine.compile(_looseCuts);
+        _tightCutEngine.setBatchEvaluation(_batchEvaluation);
+        _looseCutEngine.setBatchEvaluation(_batchEvaluation);
+
+        if (_cutFlow)
+        {
+            _tightCutEngine.enableCutFlow("tight");
+            _looseCutEngine.enableCutFlow("loose");
         }
-        if (not (particle->getUserRecord("relIso").toFloat()<0.12)) {
-            return false;
+        if (_adaptiveOrder)
+        {
+            if (_adaptiveWarmup<1)
+            {
+                throw std::runtime_error("adaptive warm-up needs to be at least 1");
+            }
+            _tightCutEngine.enableAdaptiveOrder(_adaptiveWarmup);
+            _looseCutEngine.enableAdaptiveOrder(_adaptiveWarmup);
         }
-        return true;
     }
 
-    bool passLooseCriteria(pxl::Particle* particle)
+    void endJob()
     {
-        if (not (particle->getPt()>10.0)) {
-            return false;
-        }
-        if (not (fabs(particle->getEta())<2.5)) {
-            return false;
-        }
-        if (not (particle->getPt()>10.0)) {
-            return false;
-        }
-        if (not (particle->getUserRecord("relIso").toFloat()<0.2)) {
-            return false;
-        }
-        if (not (fabs(particle->getUserRecord("dxy").toFloat())<0.2)) {
-            return false;
-        }
-        if (not (fabs(particle->getUserRecord("dz").toFloat())<0.5)) {
-            return false;
+        if (_cutFlow)
+        {
+            std::vector<const CutFlow*> cutFlows;
+            cutFlows.push_back(&_tightCutEngine.getCutFlow());
+            cutFlows.push_back(&_looseCutEngine.getCutFlow());
+            CutFlow::report(getName(),_cutFlowFileName,cutFlows);
         }
-        return true;
     }
 
     bool analyse(pxl::Sink *sink) throw (std::runtime_error)
@@ -156,60 +176,58 @@ class DefaultMuonSelection : public pxl::Module
             {
                 int numTightMuons=0;
                 int numLooseMuons=0;
-                std::vector<pxl::EventView*> eventViews;
-                event->getObjectsOfType(eventViews);
+                _eventViewIndex.build(event);
+                const std::vector<pxl::EventView*>& eventViews = _eventViewIndex.get(_inputEventViewName);
                 for (unsigned ieventView=0; ieventView<eventViews.size();++ieventView)
                 {
                     pxl::EventView* eventView = eventViews[ieventView];
-                    if (eventView->getName()==_inputEventViewName)
+                    std::vector<pxl::Particle*> particles;
+                    eventView->getObjectsOfType(particles);
+
+                    _candidates.clear();
+                    for (unsigned iparticle=0; iparticle<particles.size();++iparticle)
                     {
-                        std::vector<pxl::Particle*> particles;
-                        eventView->getObjectsOfType(particles);
+                        pxl::Particle* particle = particles[iparticle];
 
-                        for (unsigned iparticle=0; iparticle<particles.size();++iparticle)
+                        if (particle->getName()==_inputMuonName)
                         {
-                            pxl::Particle* particle = particles[iparticle];
-
-                            if (particle->getName()==_inputMuonName)
-                            {
-                                if (passTightCriteria(particle))
-                                {
-                                    particle->setName(_tightMuonName);
-                                    ++numTightMuons;
-                                } else if (passLooseCriteria(particle)) {
-                                    particle->setName(_looseMuonName);
-                                    ++numLooseMuons;
-                                } else if (_cleanEvent) {
-                                    eventView->removeObject(particle);
-                                }
-
-                            }
+                            _candidates.push_back(particle);
                         }
+                    }
 
+                    _tightCutEngine.pass(_candidates,_passTight);
+                    _remaining.clear();
+                    for (unsigned icandidate=0; icandidate<_candidates.size();++icandidate)
+                    {
+                        if (_passTight[icandidate])
+                        {
+                            _candidates[icandidate]->setName(_tightMuonName);
+                            ++numTightMuons;
+                        } else {
+                            _remaining.push_back(_candidates[icandidate]);
+                        }
+                    }
+
+                    _looseCutEngine.pass(_remaining,_passLoose);
+                    for (unsigned icandidate=0; icandidate<_remaining.size();++icandidate)
+                    {
+                        if (_passLoose[icandidate])
+                        {
+                            _remaining[icandidate]->setName(_looseMuonName);
+                            ++numLooseMuons;
+                        } else {
+                            _cleaner.reject(_remaining[icandidate]);
+                        }
                     }
+                    _cleaner.clean(eventView);
+
                 }
                 if (numLooseMuons>0)
                 {
                     _sourceVeto->setTargets(event);
                     return _sourceVeto->processTargets();
                 }
-                pxl::Source* sourceSelected=0;
-                switch (numTightMuons)
-                {
-                    case 0:
-                        sourceSelected = _sourceSelected_0muons;
-                        break;
-                    case 1:
-                        sourceSelected = _sourceSelected_1muons;
-                        break;
-                    case 2:
-                        sourceSelected = _sourceSelected_2muons;
-                        break;
-                    default:
-                        sourceSelected = _sourceSelected_othermuons;
-                }
-                sourceSelected->setTargets(event);
-                return sourceSelected->processTargets();
+                return _router.process(numTightMuons,event);
             }
         }
         catch(std::exception &e)
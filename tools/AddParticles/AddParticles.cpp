@@ -5,6 +5,8 @@
 #include "pxl/modules/Module.hh"
 #include "pxl/modules/ModuleFactory.hh"
 
+#include "EventViewIndex.hpp"
+
 static pxl::Logger logger("AddParticles");
 
 class AddParticles : public pxl::Module
@@ -14,6 +16,7 @@ class AddParticles : public pxl::Module
     pxl::Sink* _input;
 
     std::string _inputEventViewName;
+    EventViewIndex _eventViewIndex;
     
     std::string _particleName;
     int64_t _num;
@@ -98,26 +101,23 @@ class AddParticles : public pxl::Module
             {
                 bool result=false;
 
-                std::vector<pxl::EventView*> eventViews;
-                event->getObjectsOfType(eventViews);
+                _eventViewIndex.build(event);
+                const std::vector<pxl::EventView*>& eventViews = _eventViewIndex.get(_inputEventViewName);
                 for (unsigned ieventView=0; ieventView<eventViews.size();++ieventView)
                 {
                     pxl::EventView* eventView = eventViews[ieventView];
-                    if (eventView->getName()==_inputEventViewName)
+                    for (unsigned iparticle=0;iparticle<_num;++iparticle)
                     {
-                        for (unsigned iparticle=0;iparticle<_num;++iparticle)
-                        {
-                            pxl::Particle* particle = eventView->create<pxl::Particle>();
-                            particle->setName(_particleName);
-                            particle->setCharge(_charge);
-                            pxl::LorentzVector vec;
-                            double theta = 2.0*atan(exp(-_eta));
-                            double r =_pt/sin(theta);
-                            vec.setRThetaPhi(r,theta,_phi);
-                            particle->setP4(vec);
-                        }
-                        
+                        pxl::Particle* particle = eventView->create<pxl::Particle>();
+                        particle->setName(_particleName);
+                        particle->setCharge(_charge);
+                        pxl::LorentzVector vec;
+                        double theta = 2.0*atan(exp(-_eta));
+                        double r =_pt/sin(theta);
+                        vec.setRThetaPhi(r,theta,_phi);
+                        particle->setP4(vec);
                     }
+                    
                 }
                 
             }
@@ -5,6 +5,8 @@
 #include "pxl/modules/Module.hh"
 #include "pxl/modules/ModuleFactory.hh"
 
+#include "EventViewIndex.hpp"
+
 static pxl::Logger logger("FinalStateNaming");
 
 class FinalStateNaming : public pxl::Module
@@ -19,6 +21,7 @@ class FinalStateNaming : public pxl::Module
     pxl::Source* _output_fail;
 
     std::string _inputEventViewName;
+    EventViewIndex _eventViewIndex;
 
     public:
     FinalStateNaming() :
@@ -163,24 +166,21 @@ class FinalStateNaming : public pxl::Module
             {
                 bool result=false;
 
-                std::vector<pxl::EventView*> eventViews;
-                event->getObjectsOfType(eventViews);
+                _eventViewIndex.build(event);
+                const std::vector<pxl::EventView*>& eventViews = _eventViewIndex.get(_inputEventViewName);
                 for (unsigned ieventView=0; ieventView<eventViews.size();++ieventView)
                 {
                     pxl::EventView* eventView = eventViews[ieventView];
-                    if (eventView->getName()==_inputEventViewName)
-                    {
 
-                        std::vector<pxl::Particle*> particles;
-                        eventView->getObjectsOfType(particles);
-                        if (sink==_input_tHq)
-                        {
-                            result=name_tHq(particles);
-                        }
-                        else if (sink==_input_tt)
-                        {
-                            result=name_tt(particles);
-                        }
+                    std::vector<pxl::Particle*> particles;
+                    eventView->getObjectsOfType(particles);
+                    if (sink==_input_tHq)
+                    {
+                        result=name_tHq(particles);
+                    }
+                    else if (sink==_input_tt)
+                    {
+                        result=name_tt(particles);
                     }
                 }
                 if (!result)